@@ -53,7 +53,14 @@ ifneq ($(strip $(DEBUG)), 0)
 CONSOLE_ENABLE = yes
 endif
 
-ifneq ($(filter $(FULL_TESTS),$(TEST)),)
+ifeq ($(strip $(BENCH)),yes)
+# Benchmarks are timed, so optimise them the way firmware is
+OPT = s
+FULL_TEST = yes
+include tests/test_common/build.mk
+include $(TEST_PATH)/bench.mk
+else ifneq ($(filter $(FULL_TESTS),$(TEST)),)
+FULL_TEST = yes
 include tests/test_common/build.mk
 include $(TEST_PATH)/test.mk
 endif
@@ -62,17 +69,22 @@ include $(BUILDDEFS_PATH)/common_features.mk
 include $(BUILDDEFS_PATH)/generic_features.mk
 include $(PLATFORM_PATH)/common.mk
 include $(TMK_PATH)/protocol.mk
+include $(QUANTUM_PATH)/audio/tests/rules.mk
 include $(QUANTUM_PATH)/battery/tests/rules.mk
 include $(QUANTUM_PATH)/debounce/tests/rules.mk
 include $(QUANTUM_PATH)/encoder/tests/rules.mk
 include $(QUANTUM_PATH)/os_detection/tests/rules.mk
 include $(QUANTUM_PATH)/sequencer/tests/rules.mk
+include $(QUANTUM_PATH)/split_common/tests/rules.mk
 include $(QUANTUM_PATH)/wear_leveling/tests/rules.mk
 include $(QUANTUM_PATH)/logging/print.mk
 include $(PLATFORM_PATH)/test/rules.mk
-ifneq ($(filter $(FULL_TESTS),$(TEST)),)
+ifeq ($(FULL_TEST),yes)
 include $(BUILDDEFS_PATH)/build_full_test.mk
 endif
+ifeq ($(strip $(BENCH)),yes)
+$(TEST_OUTPUT)_SRC += tests/test_common/benchmark.cpp
+endif
 
 $(TEST_OUTPUT)_SRC += \
 	tests/test_common/main.cpp \
@@ -57,6 +57,7 @@ ifeq ($(strip $(AUDIO_ENABLE)), yes)
             OPT_DEFS += -DAUDIO_DRIVER_DAC
         else ifeq ($(strip $(AUDIO_DRIVER)), dac_additive)
             OPT_DEFS += -DAUDIO_DRIVER_DAC
+            SRC += $(QUANTUM_DIR)/audio/audio_dds.c
         ## stm32f2 and above have a usable DAC unit, f1 do not, and need to use pwm instead
         else ifeq ($(strip $(AUDIO_DRIVER)), pwm_software)
             OPT_DEFS += -DAUDIO_DRIVER_PWM
@@ -694,7 +695,8 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     # Determine which (if any) transport files are required
     ifneq ($(strip $(SPLIT_TRANSPORT)), custom)
         QUANTUM_SRC += $(QUANTUM_DIR)/split_common/transport.c \
-                       $(QUANTUM_DIR)/split_common/transactions.c
+                       $(QUANTUM_DIR)/split_common/transactions.c \
+                       $(QUANTUM_DIR)/split_common/bulk_sync.c
 
         OPT_DEFS += -DSPLIT_COMMON_TRANSACTIONS
 
@@ -712,6 +714,7 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
             QUANTUM_LIB_SRC += serial.c
         else
             QUANTUM_LIB_SRC += serial_protocol.c
+            QUANTUM_LIB_SRC += serial_matrix_push.c
             QUANTUM_LIB_SRC += serial_$(strip $(SERIAL_DRIVER)).c
         endif
     endif
@@ -39,12 +39,14 @@ GENERIC_FEATURES = \
     KEYCODE_STRING \
     KEY_LOCK \
     KEY_OVERRIDE \
+    LATENCY_TRACE \
     LAYER_LOCK \
     LEADER \
     MAGIC \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILING \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
@@ -50,11 +50,26 @@ void eeprom_write_dword(uint32_t *addr, uint32_t value) {
 }
 
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
-    uint8_t read_buf[len];
+    if (len == 0) {
+        return;
+    }
+
+    const uint8_t *data = buf;
+    uint8_t        read_buf[len];
     eeprom_read_block(read_buf, addr, len);
-    if (memcmp(buf, read_buf, len) != 0) {
-        eeprom_write_block(buf, addr, len);
+
+    // Only write the span that changed, drivers split it into page writes
+    size_t first = 0, last = len;
+    while (first < len && data[first] == read_buf[first]) {
+        first++;
+    }
+    if (first == len) {
+        return;
+    }
+    while (data[last - 1] == read_buf[last - 1]) {
+        last--;
     }
+    eeprom_write_block(&data[first], (uint8_t *)addr + first, last - first);
 }
 
 void eeprom_update_byte(uint8_t *addr, uint8_t value) {
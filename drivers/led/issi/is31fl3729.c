@@ -20,10 +20,14 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "led/pwm_buffer_dirty.h"
 
 #define IS31FL3729_PWM_REGISTER_COUNT 143
+#define IS31FL3729_PWM_TRANSFER_SIZE 13
 #define IS31FL3729_SCALING_REGISTER_COUNT 16
 
+PWM_BUFFER_DIRTY_STATIC_ASSERT(IS31FL3729_PWM_REGISTER_COUNT, IS31FL3729_PWM_TRANSFER_SIZE);
+
 #ifndef IS31FL3729_I2C_TIMEOUT
 #    define IS31FL3729_I2C_TIMEOUT 100
 #endif
@@ -80,15 +84,15 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // These buffers match the PWM & scaling registers.
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
-    uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t            pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
+    pwm_buffer_dirty_t pwm_buffer_dirty;
+    uint8_t            scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
+    bool               scaling_buffer_dirty;
 } PACKED is31fl3729_driver_t;
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = 0,
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -105,15 +109,20 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 
 void is31fl3729_write_pwm_buffer(uint8_t index) {
     // Transmit PWM registers in 11 transfers of 13 bytes.
+    // Only the transfers holding changed registers are sent.
 
     // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
+    for (uint8_t i = 0; i < IS31FL3729_PWM_REGISTER_COUNT; i += IS31FL3729_PWM_TRANSFER_SIZE) {
+        if (!pwm_buffer_dirty_check(driver_buffers[index].pwm_buffer_dirty, i, IS31FL3729_PWM_TRANSFER_SIZE)) {
+            continue;
+        }
+
 #if IS31FL3729_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, IS31FL3729_PWM_TRANSFER_SIZE, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, IS31FL3729_PWM_TRANSFER_SIZE, IS31FL3729_I2C_TIMEOUT);
 #endif
     }
 }
@@ -167,7 +176,9 @@ void is31fl3729_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= pwm_buffer_dirty_bit(led.r, IS31FL3729_PWM_TRANSFER_SIZE);
+        driver_buffers[led.driver].pwm_buffer_dirty |= pwm_buffer_dirty_bit(led.g, IS31FL3729_PWM_TRANSFER_SIZE);
+        driver_buffers[led.driver].pwm_buffer_dirty |= pwm_buffer_dirty_bit(led.b, IS31FL3729_PWM_TRANSFER_SIZE);
     }
 }
 
@@ -198,7 +209,7 @@ void is31fl3729_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3729_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
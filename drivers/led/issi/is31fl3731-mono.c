@@ -21,10 +21,14 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "led/pwm_buffer_dirty.h"
 
 #define IS31FL3731_PWM_REGISTER_COUNT 144
+#define IS31FL3731_PWM_TRANSFER_SIZE 16
 #define IS31FL3731_LED_CONTROL_REGISTER_COUNT 18
 
+PWM_BUFFER_DIRTY_STATIC_ASSERT(IS31FL3731_PWM_REGISTER_COUNT, IS31FL3731_PWM_TRANSFER_SIZE);
+
 #ifndef IS31FL3731_I2C_TIMEOUT
 #    define IS31FL3731_I2C_TIMEOUT 100
 #endif
@@ -52,15 +56,15 @@ const uint8_t i2c_addresses[IS31FL3731_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3731_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3731_driver_t {
-    uint8_t pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
-    bool    led_control_buffer_dirty;
+    uint8_t            pwm_buffer[IS31FL3731_PWM_REGISTER_COUNT];
+    pwm_buffer_dirty_t pwm_buffer_dirty;
+    uint8_t            led_control_buffer[IS31FL3731_LED_CONTROL_REGISTER_COUNT];
+    bool               led_control_buffer_dirty;
 } PACKED is31fl3731_driver_t;
 
 is31fl3731_driver_t driver_buffers[IS31FL3731_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = 0,
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -82,15 +86,20 @@ void is31fl3731_select_page(uint8_t index, uint8_t page) {
 void is31fl3731_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
     // Transmit PWM registers in 9 transfers of 16 bytes.
+    // Only the transfers holding changed registers are sent.
 
     // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += 16) {
+    for (uint8_t i = 0; i < IS31FL3731_PWM_REGISTER_COUNT; i += IS31FL3731_PWM_TRANSFER_SIZE) {
+        if (!pwm_buffer_dirty_check(driver_buffers[index].pwm_buffer_dirty, i, IS31FL3731_PWM_TRANSFER_SIZE)) {
+            continue;
+        }
+
 #if IS31FL3731_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3731_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, IS31FL3731_PWM_TRANSFER_SIZE, IS31FL3731_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3731_I2C_TIMEOUT);
+        i2c_write_register(i2c_addresses[index] << 1, IS31FL3731_FRAME_REG_PWM + i, driver_buffers[index].pwm_buffer + i, IS31FL3731_PWM_TRANSFER_SIZE, IS31FL3731_I2C_TIMEOUT);
 #endif
     }
 }
@@ -179,7 +188,7 @@ void is31fl3731_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        driver_buffers[led.driver].pwm_buffer_dirty |= pwm_buffer_dirty_bit(led.v, IS31FL3731_PWM_TRANSFER_SIZE);
     }
 }
 
@@ -209,7 +218,7 @@ void is31fl3731_update_pwm_buffers(uint8_t index) {
     if (driver_buffers[index].pwm_buffer_dirty) {
         is31fl3731_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_dirty = 0;
     }
 }
 
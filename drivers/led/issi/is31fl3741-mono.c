@@ -21,12 +21,18 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "led/pwm_buffer_dirty.h"
 
 #define IS31FL3741_PWM_0_REGISTER_COUNT 180
 #define IS31FL3741_PWM_1_REGISTER_COUNT 171
+#define IS31FL3741_PWM_0_TRANSFER_SIZE 30
+#define IS31FL3741_PWM_1_TRANSFER_SIZE 19
 #define IS31FL3741_SCALING_0_REGISTER_COUNT 180
 #define IS31FL3741_SCALING_1_REGISTER_COUNT 171
 
+PWM_BUFFER_DIRTY_STATIC_ASSERT(IS31FL3741_PWM_0_REGISTER_COUNT, IS31FL3741_PWM_0_TRANSFER_SIZE);
+PWM_BUFFER_DIRTY_STATIC_ASSERT(IS31FL3741_PWM_1_REGISTER_COUNT, IS31FL3741_PWM_1_TRANSFER_SIZE);
+
 #ifndef IS31FL3741_I2C_TIMEOUT
 #    define IS31FL3741_I2C_TIMEOUT 100
 #endif
@@ -75,18 +81,20 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 // buffers and the transfers in is31fl3741_write_pwm_buffer() but it's
 // probably not worth the extra complexity.
 typedef struct is31fl3741_driver_t {
-    uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
-    uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
-    uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
-    uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
-    bool    scaling_buffer_dirty;
+    uint8_t            pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
+    uint8_t            pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
+    pwm_buffer_dirty_t pwm_buffer_0_dirty;
+    pwm_buffer_dirty_t pwm_buffer_1_dirty;
+    uint8_t            scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
+    uint8_t            scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
+    bool               scaling_buffer_dirty;
 } PACKED is31fl3741_driver_t;
 
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_0_dirty   = 0,
+    .pwm_buffer_1_dirty   = 0,
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
@@ -108,34 +116,48 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
 }
 
 void is31fl3741_write_pwm_buffer(uint8_t index) {
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+    // Only the transfers holding changed registers are sent, and a page is
+    // only selected if it has any.
+    if (driver_buffers[index].pwm_buffer_0_dirty) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+
+        // Transmit PWM0 registers in 6 transfers of 30 bytes.
 
-    // Transmit PWM0 registers in 6 transfers of 30 bytes.
+        // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
+        for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += IS31FL3741_PWM_0_TRANSFER_SIZE) {
+            if (!pwm_buffer_dirty_check(driver_buffers[index].pwm_buffer_0_dirty, i, IS31FL3741_PWM_0_TRANSFER_SIZE)) {
+                continue;
+            }
 
-    // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+            for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+                if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, IS31FL3741_PWM_0_TRANSFER_SIZE, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
+            i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, IS31FL3741_PWM_0_TRANSFER_SIZE, IS31FL3741_I2C_TIMEOUT);
 #endif
+        }
     }
 
-    is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
+    if (driver_buffers[index].pwm_buffer_1_dirty) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
 
-    // Transmit PWM1 registers in 9 transfers of 19 bytes.
+        // Transmit PWM1 registers in 9 transfers of 19 bytes.
+
+        // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
+        for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += IS31FL3741_PWM_1_TRANSFER_SIZE) {
+            if (!pwm_buffer_dirty_check(driver_buffers[index].pwm_buffer_1_dirty, i, IS31FL3741_PWM_1_TRANSFER_SIZE)) {
+                continue;
+            }
 
-    // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
 #if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
+            for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
+                if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, IS31FL3741_PWM_1_TRANSFER_SIZE, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
+            i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, IS31FL3741_PWM_1_TRANSFER_SIZE, IS31FL3741_I2C_TIMEOUT);
 #endif
+        }
     }
 }
 
@@ -196,8 +218,10 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
         driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        driver_buffers[driver].pwm_buffer_1_dirty |= pwm_buffer_dirty_bit(reg & 0xFF, IS31FL3741_PWM_1_TRANSFER_SIZE);
     } else {
         driver_buffers[driver].pwm_buffer_0[reg] = value;
+        driver_buffers[driver].pwm_buffer_0_dirty |= pwm_buffer_dirty_bit(reg, IS31FL3741_PWM_0_TRANSFER_SIZE);
     }
 }
 
@@ -212,7 +236,6 @@ void is31fl3741_set_value(int index, uint8_t value) {
         }
 
         set_pwm_value(led.driver, led.v, value);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -240,16 +263,16 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (driver_buffers[index].pwm_buffer_0_dirty || driver_buffers[index].pwm_buffer_1_dirty) {
         is31fl3741_write_pwm_buffer(index);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        driver_buffers[index].pwm_buffer_0_dirty = 0;
+        driver_buffers[index].pwm_buffer_1_dirty = 0;
     }
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value) {
     set_pwm_value(pled->driver, pled->v, value);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
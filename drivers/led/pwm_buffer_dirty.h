@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "compiler_support.h"
+
+// The ISSI and SNLED drivers upload their PWM buffers in fixed size I2C
+// transfers. One bit per transfer records which ones hold changed registers,
+// so that updating a single LED does not resend the whole buffer.
+typedef uint16_t pwm_buffer_dirty_t;
+
+#define PWM_BUFFER_DIRTY_MAX_TRANSFERS (sizeof(pwm_buffer_dirty_t) * 8)
+
+// Fails the build if a PWM buffer takes more transfers than there are bits
+#define PWM_BUFFER_DIRTY_STATIC_ASSERT(register_count, transfer_size) STATIC_ASSERT(((register_count) + (transfer_size) - 1) / (transfer_size) <= PWM_BUFFER_DIRTY_MAX_TRANSFERS, "Too many PWM transfers for pwm_buffer_dirty_t")
+
+static inline pwm_buffer_dirty_t pwm_buffer_dirty_bit(uint8_t reg, uint8_t transfer_size) {
+    return (pwm_buffer_dirty_t)1 << (reg / transfer_size);
+}
+
+static inline bool pwm_buffer_dirty_check(pwm_buffer_dirty_t dirty, uint8_t offset, uint8_t transfer_size) {
+    return dirty & pwm_buffer_dirty_bit(offset, transfer_size);
+}
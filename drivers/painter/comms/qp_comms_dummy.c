@@ -25,11 +25,34 @@ uint32_t dummy_comms_send(painter_device_t device, const void *data, uint32_t by
     return byte_count;
 }
 
+#    if QUANTUM_PAINTER_ASYNC_COMMS
+static uint16_t dummy_comms_busy_polls = 0;
+
+bool dummy_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    // No-op, but reports itself as busy for a while, as a real transfer would.
+    dummy_comms_busy_polls = QUANTUM_PAINTER_DUMMY_COMMS_ASYNC_BUSY_POLLS;
+    return true;
+}
+
+bool dummy_comms_busy(painter_device_t device) {
+    if (dummy_comms_busy_polls > 0) {
+        dummy_comms_busy_polls--;
+        return true;
+    }
+    return false;
+}
+#    endif // QUANTUM_PAINTER_ASYNC_COMMS
+
 painter_comms_vtable_t dummy_comms_vtable = {
     // These are all effective no-op's because they're not actually needed.
     .comms_init  = dummy_comms_init,
     .comms_start = dummy_comms_start,
     .comms_stop  = dummy_comms_stop,
-    .comms_send  = dummy_comms_send};
+    .comms_send  = dummy_comms_send,
+#    if QUANTUM_PAINTER_ASYNC_COMMS
+    .comms_send_async = dummy_comms_send_async,
+    .comms_busy       = dummy_comms_busy,
+#    endif // QUANTUM_PAINTER_ASYNC_COMMS
+};
 
 #endif // QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
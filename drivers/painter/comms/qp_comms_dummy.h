@@ -6,6 +6,17 @@
 
 #    include "qp_internal.h"
 
+#    ifndef QUANTUM_PAINTER_DUMMY_COMMS_ASYNC_BUSY_POLLS
+// Number of times a background transfer reports itself as busy before it completes
+#        define QUANTUM_PAINTER_DUMMY_COMMS_ASYNC_BUSY_POLLS 0
+#    endif // QUANTUM_PAINTER_DUMMY_COMMS_ASYNC_BUSY_POLLS
+
+uint32_t dummy_comms_send(painter_device_t device, const void *data, uint32_t byte_count);
+#    if QUANTUM_PAINTER_ASYNC_COMMS
+bool dummy_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count);
+bool dummy_comms_busy(painter_device_t device);
+#    endif // QUANTUM_PAINTER_ASYNC_COMMS
+
 extern painter_comms_vtable_t dummy_comms_vtable;
 
 #endif // QUANTUM_PAINTER_DUMMY_COMMS_ENABLE
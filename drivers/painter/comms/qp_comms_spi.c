@@ -3,6 +3,7 @@
 
 #ifdef QUANTUM_PAINTER_SPI_ENABLE
 
+#    include "compiler_support.h"
 #    include "spi_master.h"
 #    include "qp_comms_spi.h"
 
@@ -45,6 +46,18 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    if QUANTUM_PAINTER_ASYNC_COMMS
+STATIC_ASSERT(QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE <= UINT16_MAX, "QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE must fit in a single SPI transfer");
+
+bool qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    return spi_transmit_async((const uint8_t *)data, byte_count) == SPI_STATUS_SUCCESS;
+}
+
+bool qp_comms_spi_busy(painter_device_t device) {
+    return spi_is_busy();
+}
+#    endif // QUANTUM_PAINTER_ASYNC_COMMS
+
 bool qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t      *driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -58,6 +71,10 @@ const painter_comms_vtable_t spi_comms_vtable = {
     .comms_start = qp_comms_spi_start,
     .comms_send  = qp_comms_spi_send_data,
     .comms_stop  = qp_comms_spi_stop,
+#    if QUANTUM_PAINTER_ASYNC_COMMS
+    .comms_send_async = qp_comms_spi_send_data_async,
+    .comms_busy       = qp_comms_spi_busy,
+#    endif // QUANTUM_PAINTER_ASYNC_COMMS
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,6 +115,15 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        if QUANTUM_PAINTER_ASYNC_COMMS
+bool qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t               *driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    gpio_write_pin_high(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+#        endif // QUANTUM_PAINTER_ASYNC_COMMS
+
 bool qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t               *driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
@@ -139,6 +165,10 @@ const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
             .comms_start = qp_comms_spi_start,
             .comms_send  = qp_comms_spi_dc_reset_send_data,
             .comms_stop  = qp_comms_spi_stop,
+#        if QUANTUM_PAINTER_ASYNC_COMMS
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+            .comms_busy       = qp_comms_spi_busy,
+#        endif // QUANTUM_PAINTER_ASYNC_COMMS
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
@@ -21,6 +21,15 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_NUM_DIRTY_REGIONS
+/**
+ * @def This controls the maximum number of separate dirty regions each surface tracks. Drawing to distant areas of a
+ *      surface keeps them as separate regions, so that \ref qp_surface_draw only transfers the areas that changed.
+ *      Regions are merged when they overlap, or when the limit is reached. Each region requires 8 bytes of RAM.
+ */
+#    define SURFACE_NUM_DIRTY_REGIONS 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -63,7 +72,7 @@ painter_device_t qp_make_rgb888_surface(uint16_t panel_width, uint16_t panel_hei
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
- * After successful completion, the dirty area is reset.
+ * Each dirty region is transferred separately. After successful completion, the dirty area is reset.
  *
  * @param surface[in] the surface to copy from
  * @param target[in] the target device to copy into
@@ -29,6 +29,127 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+static inline uint32_t qp_surface_region_area(uint16_t l, uint16_t t, uint16_t r, uint16_t b) {
+    return (uint32_t)(r - l + 1) * (uint32_t)(b - t + 1);
+}
+
+// Area added by growing a region to cover the other, ignoring any overlap between the two
+static inline uint32_t qp_surface_region_merge_cost(const surface_dirty_region_t *a, const surface_dirty_region_t *b) {
+    uint32_t merged = qp_surface_region_area(MIN(a->l, b->l), MIN(a->t, b->t), MAX(a->r, b->r), MAX(a->b, b->b));
+    uint32_t parts  = qp_surface_region_area(a->l, a->t, a->r, a->b) + qp_surface_region_area(b->l, b->t, b->r, b->b);
+    return merged > parts ? merged - parts : 0;
+}
+
+static inline void qp_surface_region_merge(surface_dirty_region_t *into, const surface_dirty_region_t *from) {
+    into->l = MIN(into->l, from->l);
+    into->t = MIN(into->t, from->t);
+    into->r = MAX(into->r, from->r);
+    into->b = MAX(into->b, from->b);
+}
+
+static inline bool qp_surface_region_contains(const surface_dirty_region_t *outer, const surface_dirty_region_t *inner) {
+    return inner->l >= outer->l && inner->r <= outer->r && inner->t >= outer->t && inner->b <= outer->b;
+}
+
+// Whether the two regions overlap or share an edge
+static inline bool qp_surface_region_touches(const surface_dirty_region_t *a, const surface_dirty_region_t *b) {
+    return a->l <= b->r + 1 && b->l <= a->r + 1 && a->t <= b->b + 1 && b->t <= a->b + 1;
+}
+
+// Folds any regions overlapping the region at the supplied index into it, after it has grown, returning its new index
+static uint8_t qp_surface_coalesce_dirty_regions(surface_dirty_data_t *dirty, uint8_t index) {
+    uint8_t i = 0;
+    while (i < dirty->num_regions) {
+        surface_dirty_region_t *grown = &dirty->regions[index];
+        surface_dirty_region_t *other = &dirty->regions[i];
+        if (i != index && other->l <= grown->r && grown->l <= other->r && other->t <= grown->b && grown->t <= other->b) {
+            qp_surface_region_merge(grown, other);
+
+            // Move the last region into the vacated slot, and rescan as the grown region may now overlap others
+            dirty->num_regions--;
+            dirty->regions[i] = dirty->regions[dirty->num_regions];
+            if (index == dirty->num_regions) {
+                index = i;
+            }
+            i = 0;
+            continue;
+        }
+        ++i;
+    }
+    return index;
+}
+
+// Adds a rectangle to the dirty regions, merging as required
+static void qp_surface_add_dirty_region(surface_dirty_data_t *dirty, const surface_dirty_region_t *rect) {
+    // Drawing tends to stay in the same area, so try the most recently touched region first
+    if (dirty->last_region < dirty->num_regions) {
+        surface_dirty_region_t *region = &dirty->regions[dirty->last_region];
+        if (qp_surface_region_contains(region, rect)) {
+            return;
+        }
+        if (qp_surface_region_touches(region, rect)) {
+            qp_surface_region_merge(region, rect);
+            dirty->last_region = qp_surface_coalesce_dirty_regions(dirty, dirty->last_region);
+            return;
+        }
+    }
+
+    // Nothing more to do if the rectangle is already part of a region
+    for (uint8_t i = 0; i < dirty->num_regions; ++i) {
+        if (qp_surface_region_contains(&dirty->regions[i], rect)) {
+            dirty->last_region = i;
+            return;
+        }
+    }
+
+    // Grow any region the rectangle overlaps or is adjacent to
+    for (uint8_t i = 0; i < dirty->num_regions; ++i) {
+        if (qp_surface_region_touches(&dirty->regions[i], rect)) {
+            qp_surface_region_merge(&dirty->regions[i], rect);
+            dirty->last_region = qp_surface_coalesce_dirty_regions(dirty, i);
+            return;
+        }
+    }
+
+    // Start a new region if there's space
+    if (dirty->num_regions < SURFACE_NUM_DIRTY_REGIONS) {
+        dirty->last_region                   = dirty->num_regions;
+        dirty->regions[dirty->num_regions++] = *rect;
+        return;
+    }
+
+    // Otherwise, either grow the region closest to the rectangle, or merge the two closest regions to make room for
+    // it -- whichever adds the least area
+    uint8_t  merge_a   = 0;
+    uint8_t  merge_b   = 0;
+    uint32_t best_cost = UINT32_MAX;
+    for (uint8_t i = 0; i < dirty->num_regions; ++i) {
+        uint32_t cost = qp_surface_region_merge_cost(&dirty->regions[i], rect);
+        if (cost < best_cost) {
+            merge_a = merge_b = i;
+            best_cost         = cost;
+        }
+        for (uint8_t j = i + 1; j < dirty->num_regions; ++j) {
+            cost = qp_surface_region_merge_cost(&dirty->regions[i], &dirty->regions[j]);
+            if (cost < best_cost) {
+                merge_a   = i;
+                merge_b   = j;
+                best_cost = cost;
+            }
+        }
+    }
+
+    if (merge_a == merge_b) {
+        qp_surface_region_merge(&dirty->regions[merge_a], rect);
+        dirty->last_region = qp_surface_coalesce_dirty_regions(dirty, merge_a);
+    } else {
+        qp_surface_region_merge(&dirty->regions[merge_a], &dirty->regions[merge_b]);
+        dirty->regions[merge_b] = *rect;
+        qp_surface_coalesce_dirty_regions(dirty, merge_a);
+        dirty->last_region = merge_b < dirty->num_regions ? merge_b : 0;
+    }
+}
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
     // Maintain dirty region
     if (dirty->l > x) {
@@ -47,6 +168,24 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+    // Accumulate the area changed by the current pixdata call, which is added to the regions once it completes
+    if (!dirty->has_pending) {
+        dirty->pending     = (surface_dirty_region_t){.l = x, .t = y, .r = x, .b = y};
+        dirty->has_pending = true;
+        return;
+    }
+    dirty->pending.l = MIN(dirty->pending.l, x);
+    dirty->pending.t = MIN(dirty->pending.t, y);
+    dirty->pending.r = MAX(dirty->pending.r, x);
+    dirty->pending.b = MAX(dirty->pending.b, y);
+}
+
+void qp_surface_commit_dirty(surface_dirty_data_t *dirty) {
+    if (dirty->has_pending) {
+        qp_surface_add_dirty_region(dirty, &dirty->pending);
+        dirty->has_pending = false;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +202,11 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+    surface->dirty.num_regions = 1;
+    surface->dirty.regions[0]  = (surface_dirty_region_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
+    surface->dirty.last_region = 0;
+    surface->dirty.has_pending = false;
+
     return true;
 }
 
@@ -83,6 +227,9 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    surface->dirty.num_regions          = 0;
+    surface->dirty.last_region          = 0;
+    surface->dirty.has_pending          = false;
     return true;
 }
 
@@ -122,9 +269,17 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
         return false;
     }
 
-    // Offload to the pixdata transfer function
+    // Offload to the pixdata transfer function, once per region
     surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
-    bool                             ok     = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
+    bool                             ok     = true;
+    if (entire_surface) {
+        surface_dirty_region_t everything = {.l = 0, .t = 0, .r = surface_driver->panel_width - 1, .b = surface_driver->panel_height - 1};
+        ok                                = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, &everything);
+    } else {
+        for (uint8_t i = 0; ok && i < surface_handle->dirty.num_regions; ++i) {
+            ok = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, &surface_handle->dirty.regions[i]);
+        }
+    }
     if (!ok) {
         qp_dprintf("qp_surface_draw: fail (could not transfer pixel data)\n");
         return false;
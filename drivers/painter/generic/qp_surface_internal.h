@@ -9,19 +9,36 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Internal declarations
 
+typedef struct surface_dirty_region_t {
+    uint16_t l;
+    uint16_t t;
+    uint16_t r;
+    uint16_t b;
+} surface_dirty_region_t;
+
 // Surface vtable
 typedef struct surface_painter_driver_vtable_t {
     painter_driver_vtable_t base; // must be first, so it can be cast to/from the painter_driver_vtable_t* type
 
-    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface);
+    bool (*target_pixdata_transfer)(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_region_t *region);
 } surface_painter_driver_vtable_t;
 
 typedef struct surface_dirty_data_t {
+    // Bounding box of everything drawn since the last flush
     bool     is_dirty;
     uint16_t l;
     uint16_t t;
     uint16_t r;
     uint16_t b;
+
+    // Non-overlapping regions within the bounding box which actually need to be transferred
+    uint8_t                num_regions;
+    uint8_t                last_region;
+    surface_dirty_region_t regions[SURFACE_NUM_DIRTY_REGIONS];
+
+    // Area changed by the pixdata call in progress, not yet added to the regions
+    bool                   has_pending;
+    surface_dirty_region_t pending;
 } surface_dirty_data_t;
 
 typedef struct surface_viewport_data_t {
@@ -90,6 +107,7 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+void qp_surface_commit_dirty(surface_dirty_data_t *dirty);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -58,6 +58,7 @@ static bool qp_surface_pixdata_mono1bpp(painter_device_t device, const void *pix
     painter_driver_t         *driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     stream_pixdata_mono1bpp(surface, (const uint8_t *)pixel_data, native_pixel_count);
+    qp_surface_commit_dirty(&surface->dirty);
     return true;
 }
 
@@ -84,7 +85,7 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
     return true;
 }
 
-static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_region_t *region) {
     return false; // Not yet supported.
 }
 
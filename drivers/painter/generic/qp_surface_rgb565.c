@@ -46,6 +46,7 @@ static bool qp_surface_pixdata_rgb565(painter_device_t device, const void *pixel
     painter_driver_t         *driver  = (painter_driver_t *)device;
     surface_painter_device_t *surface = (surface_painter_device_t *)driver;
     stream_pixdata_rgb565(surface, (const uint16_t *)pixel_data, native_pixel_count);
+    qp_surface_commit_dirty(&surface->dirty);
     return true;
 }
 
@@ -68,13 +69,13 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_region_t *region) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+    uint16_t l = region->l;
+    uint16_t t = region->t;
+    uint16_t r = region->r;
+    uint16_t b = region->b;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
@@ -101,8 +102,9 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
                     qp_dprintf("rgb565_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
                     return false;
                 }
-                // Reset the counter
+                // Reset the counter, and pick up the buffer to fill next, as sending may have swapped it
                 pixel_counter = 0;
+                target_buffer = (uint16_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
@@ -28,6 +28,13 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#ifdef SERIAL_USART_MATRIX_PUSH
+// target pushes its matrix without waiting for a transaction
+bool soft_serial_matrix_push(void);
+// initiator picks up pushed matrices, false if the matrix has to be read again
+bool soft_serial_matrix_pull(void);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
@@ -67,6 +67,11 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor);
 
 bool spi_start_extended(spi_start_config_t *start_config);
 
+/**
+ * \brief Called by `spi_start()` before it claims the bus, so that code which keeps the bus after its own transaction, such as Quantum Painter's background transfers, can complete it and release the bus first.
+ */
+void spi_release_deferred(void);
+
 /**
  * \brief Write a byte to the selected SPI device.
  *
@@ -93,6 +98,25 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, without waiting for the transfer to complete.
+ *
+ * Any other SPI operation waits for the transfer to complete before it begins. Platforms without asynchronous transfers send the data before returning.
+ *
+ * \param data A pointer to the data to write from. It must not be modified until `spi_is_busy()` returns `false`.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Check whether a transfer started by `spi_transmit_async()` is still in progress.
+ *
+ * \return `true` if the transfer is still in progress, otherwise `false`.
+ */
+bool spi_is_busy(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
@@ -165,6 +165,19 @@ def check_typo_against_dictionary(typo: str, line_number: int, correct_words) ->
                 cli.log.warning('{fg_yellow}Warning:%d:{fg_reset} Typo "{fg_cyan}%s{fg_reset}" would falsely trigger on correctly spelled word "{fg_cyan}%s{fg_reset}".', line_number, typo, word)
 
 
+def serialize_leaf(typo: str, correction: str) -> List[int]:
+    """Serializes the backspace count and replacement text correcting `typo`."""
+    word_boundary_ending = typo[-1] == ':'
+    typo = typo.strip(':')
+    i = 0  # Make the autocorrection data for this entry and serialize it.
+    while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
+        i += 1
+    backspaces = len(typo) - i - 1 + word_boundary_ending
+    assert 0 <= backspaces <= 63
+    correction = correction[i:]
+    return [backspaces + 128] + list(bytes(correction, 'ascii')) + [0]
+
+
 def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any]) -> List[int]:
     """Serializes trie and correction data in a form readable by the C code.
   Args:
@@ -178,18 +191,7 @@ def serialize_trie(autocorrections: List[Tuple[str, str]], trie: Dict[str, Any])
     # Traverse trie in depth first order.
     def traverse(trie_node):
         if 'LEAF' in trie_node:  # Handle a leaf trie node.
-            typo, correction = trie_node['LEAF']
-            word_boundary_ending = typo[-1] == ':'
-            typo = typo.strip(':')
-            i = 0  # Make the autocorrection data for this entry and serialize it.
-            while i < min(len(typo), len(correction)) and typo[i] == correction[i]:
-                i += 1
-            backspaces = len(typo) - i - 1 + word_boundary_ending
-            assert 0 <= backspaces <= 63
-            correction = correction[i:]
-            bs_count = [backspaces + 128]
-            data = bs_count + list(bytes(correction, 'ascii')) + [0]
-
+            data = serialize_leaf(*trie_node['LEAF'])
             entry = {'data': data, 'links': [], 'byte_offset': 0}
             table.append(entry)
         elif len(trie_node) == 1:  # Handle trie node with a single child.
@@ -241,6 +243,71 @@ def encode_link(link: Dict[str, Any]) -> List[int]:
     return [byte_offset & 255, byte_offset >> 8]
 
 
+def serialize_automaton(autocorrections: List[Tuple[str, str]]) -> List[int]:
+    """Serializes an Aho-Corasick automaton of the typos, readable by the C code.
+  The typos are stored forwards in a trie, and every node also gets a failure
+  link to the node for its longest proper suffix that is also in the trie, so
+  that the matcher can keep a single state and advance it with each keypress.
+  Args:
+    autocorrections: List of (typo, correction) tuples.
+  Returns:
+    List of ints in the range 0-255.
+  """
+    nodes = [{'children': {}, 'fail': 0, 'leaf': None, 'byte_offset': 0}]
+
+    for typo, correction in autocorrections:
+        node = 0
+        for letter in typo:
+            if letter not in nodes[node]['children']:
+                nodes.append({'children': {}, 'fail': 0, 'leaf': None, 'byte_offset': 0})
+                nodes[node]['children'][letter] = len(nodes) - 1
+            node = nodes[node]['children'][letter]
+        nodes[node]['leaf'] = (typo, correction)
+
+    # Compute failure links in breadth first order, so that a node's failure
+    # link is always known before its children are visited.
+    order = [0]
+    for node in order:
+        for letter, child in sorted(nodes[node]['children'].items()):
+            if node:
+                fail = nodes[node]['fail']
+                while fail and letter not in nodes[fail]['children']:
+                    fail = nodes[fail]['fail']
+                nodes[child]['fail'] = nodes[fail]['children'].get(letter, 0)
+            order.append(child)
+
+    def serialize(node: Dict[str, Any]) -> List[int]:
+        if node['leaf']:  # Handle a leaf node, typos are never prefixes of one another.
+            assert not node['children']
+            return serialize_leaf(*node['leaf'])
+        elif len(node['children']) == 1 and node is not nodes[0]:  # Handle a chain node, its child is serialized right after it.
+            letter = next(iter(node['children']))
+            return [TYPO_CHARS[letter] | 64] + encode_link(nodes[node['fail']])
+        else:  # Handle a branching node.
+            data = [len(node['children'])] + encode_link(nodes[node['fail']])
+            for letter, child in sorted(node['children'].items(), key=lambda e: TYPO_CHARS[e[0]]):
+                data += [TYPO_CHARS[letter]] + encode_link(nodes[child])
+            return data
+
+    # Lay out nodes in depth first order, so that chain nodes are followed by their child.
+    layout = []
+
+    def traverse(node):
+        layout.append(node)
+        for letter, child in sorted(nodes[node]['children'].items(), key=lambda e: TYPO_CHARS[e[0]]):
+            assert not nodes[nodes[child]['fail']]['leaf']
+            traverse(child)
+
+    traverse(0)
+
+    byte_offset = 0
+    for node in layout:  # To encode links, first compute byte offset of each node.
+        nodes[node]['byte_offset'] = byte_offset
+        byte_offset += len(serialize(nodes[node]))
+
+    return [b for node in layout for b in serialize(nodes[node])]  # Serialize final table.
+
+
 def typo_len(e: Tuple[str, str]) -> int:
     return len(e[0])
 
@@ -254,11 +321,15 @@ def to_hex(b: int) -> str:
 @cli.argument('-km', '--keymap', completer=keymap_completer, help='The keymap to build a firmware for. Ignored when a output file is supplied.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.argument('-a', '--automaton', arg_only=True, action='store_true', help="Generate an Aho-Corasick automaton instead of a trie, trading flash for faster matching of large dictionaries")
 @cli.subcommand('Generate the autocorrection data file from a dictionary file.')
 def generate_autocorrect_data(cli):
     autocorrections = parse_file(cli.args.filename)
-    trie = make_trie(autocorrections)
-    data = serialize_trie(autocorrections, trie)
+    if cli.args.automaton:
+        data = serialize_automaton(autocorrections)
+    else:
+        trie = make_trie(autocorrections)
+        data = serialize_trie(autocorrections, trie)
 
     current_keyboard = cli.args.keyboard or cli.config.user.keyboard or cli.config.generate_autocorrect_data.keyboard
     current_keymap = cli.args.keymap or cli.config.user.keymap or cli.config.generate_autocorrect_data.keymap
@@ -282,6 +353,8 @@ def generate_autocorrect_data(cli):
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MIN_LENGTH {len(min_typo)} // "{min_typo}"')
     autocorrect_data_h_lines.append(f'#define AUTOCORRECT_MAX_LENGTH {len(max_typo)} // "{max_typo}"')
     autocorrect_data_h_lines.append(f'#define DICTIONARY_SIZE {len(data)}')
+    if cli.args.automaton:
+        autocorrect_data_h_lines.append('#define AUTOCORRECT_DATA_AUTOMATON')
     autocorrect_data_h_lines.append('')
     autocorrect_data_h_lines.append('static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {')
     autocorrect_data_h_lines.append(textwrap.fill('    %s' % (', '.join(map(to_hex, data))), width=100, subsequent_indent='    '))
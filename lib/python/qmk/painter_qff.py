@@ -89,6 +89,17 @@ class QFFFontDescriptor:
         else:
             self.flags &= ~0x01
 
+    @property
+    def unicode_table_sorted(self):
+        return (self.flags & 0x80) == 0x80
+
+    @unicode_table_sorted.setter
+    def unicode_table_sorted(self, val):
+        if val:
+            self.flags |= 0x80
+        else:
+            self.flags &= ~0x80
+
 
 ########################################################################################################################
 
@@ -364,6 +375,7 @@ class QFFFont:
         font_descriptor.has_ascii_table = include_ascii_glyphs
         font_descriptor.unicode_glyph_count = len(unicode_table.glyphs.keys())
         font_descriptor.is_transparent = False
+        font_descriptor.unicode_table_sorted = True  # QFFUnicodeGlyphTableV1 always writes glyphs in code point order
         font_descriptor.format = format['image_format_byte']
         font_descriptor.compression = 0x01 if use_rle else 0x00
 
@@ -68,7 +68,11 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     return spi_start_extended(&start_config);
 }
 
+__attribute__((weak)) void spi_release_deferred(void) {}
+
 bool spi_start_extended(spi_start_config_t *start_config) {
+    spi_release_deferred();
+
     if (current_slave_pin != NO_PIN || start_config->slave_pin == NO_PIN) {
         return false;
     }
@@ -171,6 +175,15 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    // No DMA, so the transfer has completed by the time this returns
+    return spi_transmit(data, length);
+}
+
+bool spi_is_busy(void) {
+    return false;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spi_status_t status;
 
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "idle_sleep.h"
+
+#ifdef MATRIX_IDLE_SLEEP
+// Pin change interrupts are only wired to a few ports, which differ between
+// parts, and the 1ms timer interrupt would end every sleep long before
+// MATRIX_IDLE_SLEEP_TIMEOUT anyway.
+#    error "MATRIX_IDLE_SLEEP is not supported on AVR"
+#endif
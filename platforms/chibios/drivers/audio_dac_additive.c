@@ -16,8 +16,8 @@
  */
 
 #include "audio.h"
+#include "audio_dds.h"
 #include "gpio.h"
-#include <math.h>
 #include "util.h"
 
 // Need to disable GCC's "tautological-compare" warning for this file, as it causes issues when running `KEEP_INTERMEDIATES=yes`. Corresponding pop at the end of the file.
@@ -31,7 +31,8 @@
 
   it is also possible to have a custom sample-LUT by implementing/overriding 'dac_value_generate'
 
-  this driver allows for multiple simultaneous tones to be played through one single channel by doing additive wave-synthesis
+  this driver allows for multiple simultaneous tones to be played through one single channel by doing additive wave-synthesis,
+  in fixed-point through audio_dds.c so that no floating point maths is done per sample
 */
 
 #if !defined(AUDIO_PIN)
@@ -88,13 +89,28 @@ static const dacsample_t dac_buffer_trapezoid[] = {
 };
 #endif // AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID
 
+#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
+#    define AUDIO_DAC_WAVETABLE dac_buffer_sine
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
+#    define AUDIO_DAC_WAVETABLE dac_buffer_triangle
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
+#    define AUDIO_DAC_WAVETABLE dac_buffer_trapezoid
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
+#    define AUDIO_DAC_WAVETABLE dac_buffer_square
+#endif
+// the top bits of a voice's phase index the wavetable directly
+STATIC_ASSERT((ARRAY_SIZE(AUDIO_DAC_WAVETABLE) & (ARRAY_SIZE(AUDIO_DAC_WAVETABLE) - 1)) == 0, "The DAC wavetable length must be a power of two");
+STATIC_ASSERT(sizeof(dacsample_t) == sizeof(uint16_t), "The DAC wavetable must hold 16-bit samples");
+
+// the voices the synthesizer can hold, of those the quality presets allow to be played at once
+#define AUDIO_DAC_VOICES MIN(AUDIO_MAX_SIMULTANEOUS_TONES, AUDIO_DDS_MAX_VOICES)
+
 static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
 
-/* keep track of the sample position for for each frequency */
-static float dac_if[AUDIO_MAX_SIMULTANEOUS_TONES] = {0.0};
+/* keeps track of the phase of each frequency being played */
+static audio_dds_t dds;
 
-static float   active_tones_snapshot[AUDIO_MAX_SIMULTANEOUS_TONES] = {0};
-static uint8_t active_tones_snapshot_length                        = 0;
+static uint8_t active_tones_snapshot_length = 0;
 
 typedef enum {
     OUTPUT_SHOULD_START,
@@ -123,64 +139,27 @@ __attribute__((weak)) uint16_t dac_value_generate(void) {
     }
 
     /* doing additive wave synthesis over all currently playing tones = adding up
-     * sine-wave-samples for each frequency, scaled by the number of active tones
+     * wavetable-samples for each frequency, scaled by the number of active tones
+     *
+     * Note: a user implementation does not have to rely on the synthesizer, but
+     * could directly query the active frequencies through audio_get_processed_frequency
      */
-    uint_fast16_t value     = 0;
-    float         frequency = 0.0f;
-
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_sine);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_triangle);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_trapezoid);
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-    const size_t wavetable_length = ARRAY_SIZE(dac_buffer_square);
-#endif
-
-    for (size_t i = 0; i < active_tones_snapshot_length; i++) {
-        /* Note: a user implementation does not have to rely on the active_tones_snapshot, but
-         * could directly query the active frequencies through audio_get_processed_frequency */
-        frequency = active_tones_snapshot[i];
-
-        float new_dac_if = dac_if[i];
-        new_dac_if += frequency * ((float)wavetable_length / AUDIO_DAC_SAMPLE_RATE * 2.0f / 3.0f);
-        /*Note: the 2/3 are necessary to get the correct frequencies on the
-         *      DAC output (as measured with an oscilloscope), since the gpt
-         *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
-         *      is called twice per conversion.*/
-
-        while (new_dac_if >= wavetable_length)
-            new_dac_if -= wavetable_length;
-        dac_if[i] = new_dac_if;
-
-        // Wavetable generation/lookup
-        size_t dac_i = (size_t)new_dac_if;
+    return audio_dds_generate(&dds);
+}
 
-#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_SINE)
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
-        value += dac_buffer_trapezoid[dac_i] / active_tones_snapshot_length;
-#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length;
+/**
+ * Volume of the voices, always the full range unless AUDIO_DAC_TIMBRE_VOLUME
+ * scales it by the timbre that voices.c sets as envelope, which on the pwm
+ * drivers is the duty-cycle: a 50% duty-cycle plays at full volume, and it
+ * fades out towards 0% or 100%.
+ */
+static uint16_t dac_amplitude(void) {
+#ifdef AUDIO_DAC_TIMBRE_VOLUME
+    uint8_t timbre = MIN(voice_get_timbre(), 100);
+    return MIN(timbre, 100 - timbre) * AUDIO_DDS_AMPLITUDE_MAX / 50;
+#else
+    return AUDIO_DDS_AMPLITUDE_MAX;
 #endif
-        /*
-        // SINE
-        value += dac_buffer_sine[dac_i] / active_tones_snapshot_length / 3;
-        // TRIANGLE
-        value += dac_buffer_triangle[dac_i] / active_tones_snapshot_length / 3;
-        // SQUARE
-        value += dac_buffer_square[dac_i] / active_tones_snapshot_length / 3;
-        //NOTE: combination of these three wave-forms is more exemplary - and doesn't sound particularly good :-P
-        */
-
-        // STAIRS (mostly usefully as test-pattern)
-        // value_avg = dac_buffer_staircase[dac_i] / active_tones_snapshot_length;
-    }
-
-    return value;
 }
 
 /**
@@ -236,16 +215,22 @@ static void dac_end(DACDriver *dacp) {
         }
 
         if ((OUTPUT_SHOULD_START == state) || (OUTPUT_REACHED_ZERO_BEFORE_OFF == state) || (OUTPUT_REACHED_ZERO_BEFORE_TONE_CHANGE == state)) {
-            uint8_t active_tones         = MIN(AUDIO_MAX_SIMULTANEOUS_TONES, audio_get_number_of_active_tones());
+            uint8_t active_tones = MIN(AUDIO_DAC_VOICES, audio_get_number_of_active_tones());
+            float   active_tones_snapshot[AUDIO_DAC_VOICES];
             active_tones_snapshot_length = 0;
             // update the snapshot - once, and only on occasion that something changed;
-            // -> saves cpu cycles (?)
+            // -> saves cpu cycles, as the phase increments are only worked out here
             for (uint8_t i = 0; i < active_tones; i++) {
                 float freq = audio_get_processed_frequency(i);
                 if (freq > 0) { // disregard 'rest' notes, with valid frequency 0.0f; which would only lower the resulting waveform volume during the additive synthesis step
                     active_tones_snapshot[active_tones_snapshot_length++] = freq;
                 }
             }
+            /*Note: the 3/2 are necessary to get the correct frequencies on the
+             *      DAC output (as measured with an oscilloscope), since the gpt
+             *      timer runs with 3*AUDIO_DAC_SAMPLE_RATE; and the DAC callback
+             *      is called twice per conversion.*/
+            audio_dds_set_voices(&dds, active_tones_snapshot, active_tones_snapshot_length, AUDIO_DAC_SAMPLE_RATE * 3.0f / 2.0f, dac_amplitude());
 
             if ((0 == active_tones_snapshot_length) && (OUTPUT_REACHED_ZERO_BEFORE_OFF == state)) {
                 state = OUTPUT_OFF;
@@ -331,6 +316,7 @@ void audio_driver_initialize_impl(void) {
     for (size_t i = 0; i < AUDIO_DAC_BUFFER_SIZE; i++) {
         dac_buffer[i] = AUDIO_DAC_OFF_VALUE;
     }
+    audio_dds_init(&dds, AUDIO_DAC_WAVETABLE, ARRAY_SIZE(AUDIO_DAC_WAVETABLE));
 
     if (AUDIO_PIN == A4) {
         dacStartConversion(&DACD1, &dac_conv_cfg, dac_buffer, AUDIO_DAC_BUFFER_SIZE);
@@ -357,10 +343,8 @@ void audio_driver_stop_impl(void) {
 void audio_driver_start_impl(void) {
     gptStartContinuous(&GPTD6, 2U);
 
-    for (uint8_t i = 0; i < AUDIO_MAX_SIMULTANEOUS_TONES; i++) {
-        dac_if[i]                = 0.0f;
-        active_tones_snapshot[i] = 0.0f;
-    }
+    audio_dds_reset_phase(&dds);
+    audio_dds_set_voices(&dds, NULL, 0, AUDIO_DAC_SAMPLE_RATE, 0);
     active_tones_snapshot_length = 0;
     state                        = OUTPUT_SHOULD_START;
 }
@@ -0,0 +1,95 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "serial_matrix_push.h"
+#include "serial_protocol.h"
+#include "crc.h"
+
+#ifdef SERIAL_USART_MATRIX_PUSH
+
+/* Notification layout on the wire: marker, sequence, matrix, crc8 of sequence and matrix. */
+
+static uint8_t push_sequence = 0;
+
+bool serial_matrix_push_send(const void* matrix, size_t size) {
+    uint8_t frame[SERIAL_MATRIX_PUSH_MAX_SIZE + 3];
+
+    if (size > SERIAL_MATRIX_PUSH_MAX_SIZE) {
+        return false;
+    }
+
+    frame[0] = SERIAL_MATRIX_PUSH_MARKER;
+    frame[1] = push_sequence++;
+    memcpy(&frame[2], matrix, size);
+    frame[size + 2] = crc8(&frame[1], size + 1);
+
+    return serial_transport_send(frame, size + 3);
+}
+
+static uint8_t received_matrix[SERIAL_MATRIX_PUSH_MAX_SIZE];
+static uint8_t received_sequence = 0;
+static bool    received_any      = false;
+static bool    received_pending  = false;
+static bool    received_lost     = false;
+
+bool serial_matrix_push_receive(size_t size) {
+    uint8_t frame[SERIAL_MATRIX_PUSH_MAX_SIZE + 2];
+
+    if (size > SERIAL_MATRIX_PUSH_MAX_SIZE || !serial_transport_receive(frame, size + 2) || frame[size + 1] != crc8(frame, size + 1)) {
+        /* Whatever the slave sent is gone, the master has to read the matrix again. */
+        received_lost = true;
+        return false;
+    }
+
+    if (received_any && frame[0] != (uint8_t)(received_sequence + 1)) {
+        received_lost = true;
+    }
+
+    received_sequence = frame[0];
+    received_any      = true;
+    received_pending  = true;
+    memcpy(received_matrix, &frame[1], size);
+    return true;
+}
+
+void serial_matrix_push_drain(size_t size) {
+    uint8_t byte;
+
+    while (serial_transport_receive_available(&byte, sizeof(byte))) {
+        if (byte == SERIAL_MATRIX_PUSH_MARKER) {
+            serial_matrix_push_receive(size);
+        }
+    }
+}
+
+bool serial_matrix_push_receive_handshake(uint8_t* handshake, size_t size) {
+    while (serial_transport_receive(handshake, sizeof(*handshake))) {
+        if (*handshake != SERIAL_MATRIX_PUSH_MARKER) {
+            return true;
+        }
+        serial_matrix_push_receive(size);
+    }
+
+    return false;
+}
+
+bool serial_matrix_push_collect(void* matrix, size_t size) {
+    if (received_lost) {
+        /* The caller reads the matrix again, start over with the next sequence number. */
+        received_lost    = false;
+        received_pending = false;
+        received_any     = false;
+        return false;
+    }
+
+    if (received_pending) {
+        memcpy(matrix, received_matrix, size);
+        received_pending = false;
+    }
+
+    return true;
+}
+
+#endif // SERIAL_USART_MATRIX_PUSH
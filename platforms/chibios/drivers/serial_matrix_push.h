@@ -0,0 +1,58 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief First byte of an unsolicited matrix notification from the slave.
+ * Never a valid transaction handshake, as those stay below 0x80.
+ */
+#define SERIAL_MATRIX_PUSH_MARKER 0xA5
+
+#ifndef SERIAL_MATRIX_PUSH_MAX_SIZE
+#    define SERIAL_MATRIX_PUSH_MAX_SIZE 32
+#endif
+
+/**
+ * @brief Send the slave matrix to the master without waiting for a
+ * transaction. Every notification carries the next sequence number.
+ *
+ * @return true Send success.
+ * @return false Send failed.
+ */
+bool serial_matrix_push_send(const void* matrix, size_t size);
+
+/**
+ * @brief Read the rest of a notification after its marker byte was received.
+ *
+ * @return true A valid notification was received.
+ * @return false Receive failed or the checksum did not match.
+ */
+bool serial_matrix_push_receive(size_t size);
+
+/**
+ * @brief Consume everything already waiting in the receive queue, keeping the
+ * notifications and throwing away anything else.
+ */
+void serial_matrix_push_drain(size_t size);
+
+/**
+ * @brief Receive the handshake of a transaction, consuming any notifications
+ * the slave sent in front of it.
+ *
+ * @return true Receive success.
+ * @return false Receive failed, e.g. by timeout.
+ */
+bool serial_matrix_push_receive_handshake(uint8_t* handshake, size_t size);
+
+/**
+ * @brief Copy out the latest notification received since the last call.
+ *
+ * @return true Matrix is current, whether or not it changed.
+ * @return false Notifications were missed, the matrix has to be read again.
+ */
+bool serial_matrix_push_collect(void* matrix, size_t size);
@@ -7,6 +7,17 @@
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 
+#ifdef SERIAL_USART_MATRIX_PUSH
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error "SERIAL_USART_MATRIX_PUSH requires SERIAL_USART_FULL_DUPLEX"
+#    endif
+#    include "serial_matrix_push.h"
+#    include "compiler_support.h"
+
+STATIC_ASSERT(NUM_TOTAL_TRANSACTIONS <= 0x40, "Transaction handshakes would collide with SERIAL_MATRIX_PUSH_MARKER");
+STATIC_ASSERT(sizeof(split_shmem->smatrix.matrix) <= SERIAL_MATRIX_PUSH_MAX_SIZE, "Slave matrix too large for SERIAL_MATRIX_PUSH_MAX_SIZE");
+#endif
+
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
@@ -100,9 +111,15 @@ static inline bool react_to_transaction(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#ifdef SERIAL_USART_MATRIX_PUSH
+    /* Clear the receive queue, but keep the matrix notifications the slave
+     * sent since the last transaction. */
+    serial_matrix_push_drain(sizeof(split_shmem->smatrix.matrix));
+#else
     /* Clear the receive queue, to start with a clean slate.
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
+#endif
 
     return initiate_transaction((uint8_t)index);
 }
@@ -133,7 +150,12 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
+#ifdef SERIAL_USART_MATRIX_PUSH
+    /* The slave may have pushed a matrix notification right before it picked up the transaction. */
+    if (unlikely(!serial_matrix_push_receive_handshake(&transaction_id_shake, sizeof(split_shmem->smatrix.matrix)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+#else
     if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+#endif
         serial_dprintf("SPLIT: receiving handshake failed\n");
         return false;
     }
@@ -156,3 +178,26 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+
+#ifdef SERIAL_USART_MATRIX_PUSH
+
+/**
+ * @brief Push the slave matrix to the master half, outside of a transaction.
+ * The caller holds the split shared memory lock, so the notification can't
+ * end up in the middle of a transaction answered by the slave thread.
+ */
+bool soft_serial_matrix_push(void) {
+    return serial_matrix_push_send(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+}
+
+/**
+ * @brief Pick up the matrix notifications pushed by the slave half.
+ *
+ * @return bool Indicates the master copy of the slave matrix is current.
+ */
+bool soft_serial_matrix_pull(void) {
+    serial_matrix_push_drain(sizeof(split_shmem->smatrix.matrix));
+    return serial_matrix_push_collect(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+}
+
+#endif // SERIAL_USART_MATRIX_PUSH
@@ -40,6 +40,15 @@ bool __attribute__((nonnull, hot)) serial_transport_receive(uint8_t* destination
  */
 bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* destination, const size_t size);
 
+/**
+ * @brief Receive of size * bytes that are already waiting in the receive queue,
+ * without blocking.
+ *
+ * @return true Receive success.
+ * @return false Not enough data available or receive failed.
+ */
+bool __attribute__((nonnull)) serial_transport_receive_available(uint8_t* destination, const size_t size);
+
 /**
  * @brief Blocking send of buffer with timeout.
  *
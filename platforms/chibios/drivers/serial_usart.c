@@ -165,6 +165,11 @@ inline bool serial_transport_receive_blocking(uint8_t* destination, const size_t
     return success;
 }
 
+inline bool serial_transport_receive_available(uint8_t* destination, const size_t size) {
+    bool success = (size_t)chnReadTimeout(serial_driver, destination, size, TIME_IMMEDIATE) == size;
+    return success;
+}
+
 #if !defined(SERIAL_USART_FULL_DUPLEX)
 
 /**
@@ -67,6 +67,16 @@ static bool  current_cs_active_low = true;
 
 static SPIConfig spiConfig;
 
+bool spi_is_busy(void) {
+    // Updated from the SPI interrupt once a transfer started by spi_transmit_async() completes
+    return ((volatile SPIDriver *)&SPI_DRIVER)->state == SPI_ACTIVE;
+}
+
+static inline void spi_wait_async(void) {
+    while (spi_is_busy()) {
+    }
+}
+
 static inline void spi_select(void) {
     spiSelect(&SPI_DRIVER);
 
@@ -124,7 +134,11 @@ __attribute__((weak)) void spi_init(void) {
     }
 }
 
+__attribute__((weak)) void spi_release_deferred(void) {}
+
 bool spi_start_extended(spi_start_config_t *start_config) {
+    spi_release_deferred();
+
 #if (SPI_USE_MUTUAL_EXCLUSION == TRUE)
     spiAcquireBus(&SPI_DRIVER);
 #endif // (SPI_USE_MUTUAL_EXCLUSION == TRUE)
@@ -438,6 +452,7 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
 
 spi_status_t spi_write(uint8_t data) {
     uint8_t rxData;
+    spi_wait_async();
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
     return rxData;
@@ -445,23 +460,37 @@ spi_status_t spi_write(uint8_t data) {
 
 spi_status_t spi_read(void) {
     uint8_t data = 0;
+    spi_wait_async();
     spiReceive(&SPI_DRIVER, 1, &data);
 
     return data;
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    if (!spiStarted) {
+        return SPI_STATUS_ERROR;
+    }
+
+    spi_wait_async();
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
     if (spiStarted) {
+        spi_wait_async();
         spi_unselect();
         spiStop(&SPI_DRIVER);
         spiStarted = false;
@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Table driven encoders turning LED color bytes into the waveform the DMA
+ * pushes out, shared by the SPI and PWM drivers.
+ *
+ * Both walk the color bytes in wire order (ws2812_led_t is packed in the
+ * configured byte order) and emit the most significant bit first. Each
+ * nibble of a color byte is looked up in a 16 entry table, so encoding is a
+ * pair of copies per byte instead of a branch per bit.
+ */
+
+#define WS2812_NIBBLE_TABLE(entry) \
+    { entry(0x0), entry(0x1), entry(0x2), entry(0x3), entry(0x4), entry(0x5), entry(0x6), entry(0x7), entry(0x8), entry(0x9), entry(0xA), entry(0xB), entry(0xC), entry(0xD), entry(0xE), entry(0xF) }
+
+/* --- SPI ------------------------------------------------------------------ */
+
+/* Every SPI byte carries two LED bits, each as a four bit symbol. */
+#define WS2812_SPI_SYMBOL(bit) ((bit) ? 0b1110 : 0b1000)
+#define WS2812_SPI_NIBBLE(n) \
+    { (WS2812_SPI_SYMBOL((n) & 0x8) << 4) | WS2812_SPI_SYMBOL((n) & 0x4), (WS2812_SPI_SYMBOL((n) & 0x2) << 4) | WS2812_SPI_SYMBOL((n) & 0x1) }
+
+#define WS2812_SPI_BYTES_PER_BYTE 4
+
+static const uint8_t ws2812_spi_nibble[16][2] = WS2812_NIBBLE_TABLE(WS2812_SPI_NIBBLE);
+
+/**
+ * @brief   Encode color bytes into SPI symbols
+ *
+ * @param[out] dest:                Receives @ref WS2812_SPI_BYTES_PER_BYTE bytes per color byte
+ * @param[in] data:                 The color bytes, in wire order
+ * @param[in] length:               The number of color bytes
+ */
+static inline void ws2812_spi_encode(uint8_t *dest, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        memcpy(&dest[0], ws2812_spi_nibble[data[i] >> 4], 2);
+        memcpy(&dest[2], ws2812_spi_nibble[data[i] & 0x0F], 2);
+        dest += WS2812_SPI_BYTES_PER_BYTE;
+    }
+}
+
+/* --- PWM ------------------------------------------------------------------ */
+
+/*
+ * The PWM frame buffer holds one duty cycle per LED bit, and its element
+ * width depends on the timer and DMA controller. The includer provides
+ * ws2812_buffer_t, WS2812_DUTYCYCLE_0 and WS2812_DUTYCYCLE_1 first.
+ */
+#if defined(WS2812_DUTYCYCLE_0) && defined(WS2812_DUTYCYCLE_1)
+#    define WS2812_PWM_SYMBOL(bit) ((bit) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0)
+#    define WS2812_PWM_NIBBLE(n) \
+        { WS2812_PWM_SYMBOL((n) & 0x8), WS2812_PWM_SYMBOL((n) & 0x4), WS2812_PWM_SYMBOL((n) & 0x2), WS2812_PWM_SYMBOL((n) & 0x1) }
+
+static const ws2812_buffer_t ws2812_pwm_nibble[16][4] = WS2812_NIBBLE_TABLE(WS2812_PWM_NIBBLE);
+
+/**
+ * @brief   Encode color bytes into PWM duty cycles
+ *
+ * @param[out] dest:                Receives 8 duty cycles per color byte
+ * @param[in] data:                 The color bytes, in wire order
+ * @param[in] length:               The number of color bytes
+ */
+static inline void ws2812_pwm_encode(ws2812_buffer_t *dest, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        memcpy(&dest[0], ws2812_pwm_nibble[data[i] >> 4], sizeof(ws2812_pwm_nibble[0]));
+        memcpy(&dest[4], ws2812_pwm_nibble[data[i] & 0x0F], sizeof(ws2812_pwm_nibble[0]));
+        dest += 8;
+    }
+}
+#endif
@@ -1,6 +1,7 @@
 #include "ws2812.h"
 #include "gpio.h"
 #include "chibios_config.h"
+#include "compiler_support.h"
 
 // ======== DEPRECATED DEFINES - DO NOT USE ========
 #ifdef WS2812_DMA_STREAM
@@ -119,145 +120,6 @@
 #    error WS2812 PWM driver: High period for a 1 is more than a byte
 #endif
 
-/* --- PRIVATE MACROS ------------------------------------------------------- */
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given bit
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] byte:                 The byte number [0, 2]
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#define WS2812_BIT(led, byte, bit) (WS2812_COLOR_BITS * (led) + 8 * (byte) + (7 - (bit)))
-
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given red bit
- *
- * @note    The red byte is the middle byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_RED_BIT(led, bit) WS2812_BIT((led), 1, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given green bit
- *
- * @note    The red byte is the first byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_GREEN_BIT(led, bit) WS2812_BIT((led), 0, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given blue bit
- *
- * @note    The red byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_BLUE_BIT(led, bit) WS2812_BIT((led), 2, (bit))
-
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given red bit
- *
- * @note    The red byte is the middle byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_RED_BIT(led, bit) WS2812_BIT((led), 0, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given green bit
- *
- * @note    The red byte is the first byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_GREEN_BIT(led, bit) WS2812_BIT((led), 1, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given blue bit
- *
- * @note    The red byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_BLUE_BIT(led, bit) WS2812_BIT((led), 2, (bit))
-
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given red bit
- *
- * @note    The red byte is the middle byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_RED_BIT(led, bit) WS2812_BIT((led), 2, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given green bit
- *
- * @note    The red byte is the first byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit number [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_GREEN_BIT(led, bit) WS2812_BIT((led), 1, (bit))
-
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given blue bit
- *
- * @note    The red byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_COUNT)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_BLUE_BIT(led, bit) WS2812_BIT((led), 0, (bit))
-#endif
-
-#ifdef WS2812_RGBW
-/**
- * @brief   Determine the index in @ref ws2812_frame_buffer "the frame buffer" of a given white bit
- *
- * @note    The white byte is the last byte in the color packet
- *
- * @param[in] led:                  The led index [0, @ref WS2812_LED_N)
- * @param[in] bit:                  The bit index [0, 7]
- *
- * @return                          The bit index
- */
-#    define WS2812_WHITE_BIT(led, bit) WS2812_BIT((led), 3, (bit))
-#endif
-
 /* --- PRIVATE VARIABLES ---------------------------------------------------- */
 
 // STM32F2XX, STM32F4XX and STM32F7XX do NOT zero pad DMA transfers of unequal data width. Buffer width must match TIMx CCR.
@@ -292,6 +154,9 @@ typedef uint8_t ws2812_buffer_t;
 
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
 
+// Needs ws2812_buffer_t and the duty cycles
+#include "ws2812_encoder.h"
+
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
  * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
@@ -372,28 +237,10 @@ void ws2812_init(void) {
     pwmEnableChannel(&WS2812_PWM_DRIVER, WS2812_PWM_CHANNEL - 1, 0); // Initial period is 0; output will be low until first duty cycle is DMA'd in
 }
 
-void ws2812_write_led(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b) {
-    // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-    }
-}
-void ws2812_write_led_rgbw(uint16_t led_number, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
-    // Write color to frame buffer
-    for (uint8_t bit = 0; bit < 8; bit++) {
-        ws2812_frame_buffer[WS2812_RED_BIT(led_number, bit)]   = ((r >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_GREEN_BIT(led_number, bit)] = ((g >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-        ws2812_frame_buffer[WS2812_BLUE_BIT(led_number, bit)]  = ((b >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-#ifdef WS2812_RGBW
-        ws2812_frame_buffer[WS2812_WHITE_BIT(led_number, bit)] = ((w >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
-#endif
-    }
-}
-
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+STATIC_ASSERT(sizeof(ws2812_led_t) == WS2812_CHANNELS, "ws2812_led_t must hold exactly the bytes sent to each LED");
+
 void ws2812_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     ws2812_leds[index].r = red;
     ws2812_leds[index].g = green;
@@ -410,11 +257,6 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-#if defined(WS2812_RGBW)
-        ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
-#else
-        ws2812_write_led(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b);
-#endif
-    }
+    // ws2812_led_t is packed in wire order, so the colors are encoded as they are
+    ws2812_pwm_encode(ws2812_frame_buffer, (const uint8_t *)ws2812_leds, sizeof(ws2812_leds));
 }
@@ -2,6 +2,8 @@
 #include "gpio.h"
 #include "util.h"
 #include "chibios_config.h"
+#include "compiler_support.h"
+#include "ws2812_encoder.h"
 
 /* Adapted from https://github.com/gamazeps/ws2812b-chibios-SPIDMA/ */
 
@@ -102,7 +104,7 @@
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE(WS2812_SPI_SCK_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL
 #endif
 
-#define BYTES_FOR_LED_BYTE 4
+#define BYTES_FOR_LED_BYTE WS2812_SPI_BYTES_PER_BYTE
 #ifdef WS2812_RGBW
 #    define WS2812_CHANNELS 4
 #else
@@ -113,59 +115,41 @@
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
+
+#if defined(WS2812_SPI_DOUBLE_BUFFER)
+#    if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#        error "WS2812_SPI_DOUBLE_BUFFER cannot be combined with WS2812_SPI_USE_CIRCULAR_BUFFER or WS2812_SPI_SYNC"
+#    endif
 
 /*
- * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
+ * One buffer is on the wire while the next frame is encoded into the other.
+ * A frame encoded before the previous one has finished sending is left
+ * pending, and started from the end of transfer callback.
  */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
+static uint8_t           txbuf[2][TXBUF_SIZE] = {0};
+static volatile uint8_t  txbuf_back           = 0;
+static uint8_t* volatile txbuf_pending        = NULL;
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
-
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
-#endif
-#ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
-#endif
+static void ws2812_spi_end_cb(SPIDriver* spip) {
+    chSysLockFromISR();
+    if (txbuf_pending != NULL) {
+        spiStartSendI(spip, TXBUF_SIZE, txbuf_pending);
+        txbuf_pending = NULL;
+        txbuf_back ^= 1;
+    }
+    chSysUnlockFromISR();
 }
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+static uint8_t txbuf[TXBUF_SIZE] = {0};
+#    define WS2812_SPI_END_CB NULL
+#endif
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
 
+STATIC_ASSERT(sizeof(ws2812_led_t) == WS2812_CHANNELS, "ws2812_led_t must hold exactly the bytes sent to each LED");
+
 void ws2812_init(void) {
     palSetLineMode(WS2812_DI_PIN, WS2812_MOSI_OUTPUT_MODE);
 
@@ -180,7 +164,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -198,7 +182,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -239,17 +223,35 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+#if defined(WS2812_SPI_DOUBLE_BUFFER)
+    // A frame still waiting for the bus is superseded, its buffer is free again
+    chSysLock();
+    txbuf_pending = NULL;
+    chSysUnlock();
+
+    uint8_t* buffer = txbuf[txbuf_back];
+    ws2812_spi_encode(&buffer[PREAMBLE_SIZE], (const uint8_t*)ws2812_leds, sizeof(ws2812_leds));
+
+    chSysLock();
+    if (WS2812_SPI_DRIVER.state == SPI_READY) {
+        spiStartSendI(&WS2812_SPI_DRIVER, TXBUF_SIZE, buffer);
+        txbuf_back ^= 1;
+    } else {
+        txbuf_pending = buffer;
     }
+    chSysUnlock();
+#else
+    // ws2812_led_t is packed in wire order, so the colors are encoded as they are
+    ws2812_spi_encode(&txbuf[PREAMBLE_SIZE], (const uint8_t*)ws2812_leds, sizeof(ws2812_leds));
 
     // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
-#    ifdef WS2812_SPI_SYNC
+    // Instead spiSend can be used to send synchronously, or WS2812_SPI_DOUBLE_BUFFER to encode while the previous frame is sent.
+#    ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+#        ifdef WS2812_SPI_SYNC
     spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
-#    else
+#        else
     spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+#        endif
 #    endif
 #endif
 }
@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+
+#include "idle_sleep.h"
+
+#ifdef MATRIX_IDLE_SLEEP
+#    if !PAL_USE_CALLBACKS
+#        error "MATRIX_IDLE_SLEEP requires PAL_USE_CALLBACKS to be enabled in halconf.h"
+#    endif
+
+static BSEMAPHORE_DECL(idle_sleep_wake, true);
+
+static void idle_sleep_wake_callback(void *arg) {
+    (void)arg;
+
+    chSysLockFromISR();
+    chBSemSignalI(&idle_sleep_wake);
+    chSysUnlockFromISR();
+}
+
+void idle_sleep_wake_pin_enable(pin_t pin) {
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, idle_sleep_wake_callback, NULL);
+}
+
+void idle_sleep_wake_pin_disable(pin_t pin) {
+    palDisableLineEvent(pin);
+}
+
+void idle_sleep(uint32_t timeout_ms) {
+    // Blocking the main thread lets the idle thread put the core to sleep. An
+    // edge that arrived after the pins were armed leaves the semaphore
+    // signalled, so it cannot be missed here.
+    chBSemWaitTimeout(&idle_sleep_wake, TIME_MS2I(timeout_ms));
+}
+#endif
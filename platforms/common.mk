@@ -5,6 +5,7 @@ SRC +=	\
 	$(PLATFORM_PATH)/synchronization_util.c \
 	$(PLATFORM_PATH)/timer.c \
 	$(PLATFORM_COMMON_DIR)/hardware_id.c \
+	$(PLATFORM_COMMON_DIR)/idle_sleep.c \
 	$(PLATFORM_COMMON_DIR)/platform.c \
 	$(PLATFORM_COMMON_DIR)/suspend.c \
 	$(PLATFORM_COMMON_DIR)/timer.c \
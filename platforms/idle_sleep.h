@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "gpio.h"
+
+/**
+ * \brief Sleeps the main loop until a wake pin changes or the timeout elapses.
+ *
+ * May return early on any interrupt; callers re-check their state afterwards.
+ */
+void idle_sleep(uint32_t timeout_ms);
+
+#if __has_include("_pin_defs.h") // not available on platforms without GPIO
+/**
+ * \brief Arms an interrupt on both edges of the pin that ends `idle_sleep()`.
+ *
+ * Platforms without per-pin wake interrupts may leave this empty as long as
+ * `idle_sleep()` returns on the next periodic interrupt instead.
+ */
+void idle_sleep_wake_pin_enable(pin_t pin);
+
+/**
+ * \brief Disarms the wake interrupt previously set up on the pin.
+ */
+void idle_sleep_wake_pin_disable(pin_t pin);
+#endif
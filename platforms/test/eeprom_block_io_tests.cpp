@@ -0,0 +1,120 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+// The transient driver is wrapped, to count what an external EEPROM would be asked to do
+#define eeprom_read_block transient_eeprom_read_block
+#define eeprom_write_block transient_eeprom_write_block
+#include "eeprom_transient.c"
+#include "util.h"
+#undef eeprom_read_block
+#undef eeprom_write_block
+}
+
+#define PAGE_SIZE 32
+#define PACKET_SIZE 28
+#define STREAM_BUFFER_SIZE 256
+#define KEYMAP_SIZE (8 * 6 * 17 * 2)
+
+static struct {
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t pages; // page writes, as split by eeprom_i2c.c and eeprom_spi.c
+} counts;
+
+extern "C" void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    counts.reads++;
+    transient_eeprom_read_block(buf, addr, len);
+}
+
+extern "C" void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    uintptr_t target = (uintptr_t)addr;
+    counts.writes++;
+    counts.pages += (target + len - 1) / PAGE_SIZE - target / PAGE_SIZE + 1;
+    transient_eeprom_write_block(buf, addr, len);
+}
+
+/* Writes a keymap the way nvm_dynamic_keymap_update_buffer() used to, byte by byte. */
+static void upload_bytes(const uint8_t *keymap) {
+    for (uint16_t offset = 0; offset < KEYMAP_SIZE; offset += PACKET_SIZE) {
+        for (uint16_t i = offset; i < offset + PACKET_SIZE && i < KEYMAP_SIZE; i++) {
+            eeprom_update_byte((uint8_t *)(uintptr_t)i, keymap[i]);
+        }
+    }
+}
+
+/* One block update per VIA packet. */
+static void upload_blocks(const uint8_t *keymap) {
+    for (uint16_t offset = 0; offset < KEYMAP_SIZE; offset += PACKET_SIZE) {
+        eeprom_update_block(&keymap[offset], (void *)(uintptr_t)offset, MIN(PACKET_SIZE, KEYMAP_SIZE - offset));
+    }
+}
+
+/* Packets staged and written a stream buffer at a time, as dynamic_keymap_stream_buffer() does. */
+static void upload_streamed(const uint8_t *keymap) {
+    for (uint16_t offset = 0; offset < KEYMAP_SIZE; offset += STREAM_BUFFER_SIZE) {
+        eeprom_update_block(&keymap[offset], (void *)(uintptr_t)offset, MIN(STREAM_BUFFER_SIZE, KEYMAP_SIZE - offset));
+    }
+}
+
+class EepromBlockIo : public testing::Test {
+   protected:
+    void SetUp() override {
+        eeprom_driver_erase();
+        counts = {};
+        for (size_t i = 0; i < sizeof(keymap); i++) {
+            keymap[i] = (uint8_t)(i * 37 + 11);
+        }
+    }
+
+    void expect_written(void) {
+        uint8_t actual[KEYMAP_SIZE];
+        transient_eeprom_read_block(actual, 0, sizeof(actual));
+        EXPECT_EQ(memcmp(keymap, actual, sizeof(actual)), 0);
+    }
+
+    uint8_t keymap[KEYMAP_SIZE];
+};
+
+TEST_F(EepromBlockIo, UpdateBlockSkipsUnchanged) {
+    upload_blocks(keymap);
+    counts = {};
+
+    upload_blocks(keymap);
+    EXPECT_EQ(counts.writes, 0);
+}
+
+TEST_F(EepromBlockIo, UpdateBlockOnlyWritesChangedSpan) {
+    upload_blocks(keymap);
+    counts = {};
+
+    keymap[100] ^= 0xFF;
+    keymap[103] ^= 0xFF;
+    eeprom_update_block(&keymap[96], (void *)96, 16);
+    EXPECT_EQ(counts.writes, 1);
+    EXPECT_EQ(counts.pages, 1);
+    expect_written();
+}
+
+TEST_F(EepromBlockIo, KeymapUpload) {
+    upload_bytes(keymap);
+    expect_written();
+    auto bytes = counts;
+
+    eeprom_driver_erase();
+    counts = {};
+    upload_blocks(keymap);
+    expect_written();
+    auto blocks = counts;
+
+    eeprom_driver_erase();
+    counts = {};
+    upload_streamed(keymap);
+    expect_written();
+    auto streamed = counts;
+
+    EXPECT_LT(blocks.pages, bytes.pages);
+    EXPECT_LT(streamed.pages, blocks.pages);
+}
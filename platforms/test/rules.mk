@@ -23,3 +23,29 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+serial_matrix_push_DEFS := -DSERIAL_USART_MATRIX_PUSH -DNO_PRINT
+
+serial_matrix_push_INC := \
+	$(PLATFORM_PATH)/chibios/drivers/
+
+serial_matrix_push_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/serial_matrix_push_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/serial_loopback.c \
+	$(PLATFORM_PATH)/chibios/drivers/serial_matrix_push.c \
+	$(QUANTUM_PATH)/crc.c
+
+ws2812_encoder_INC := \
+	$(PLATFORM_PATH)/chibios/drivers/
+
+ws2812_encoder_SRC := \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_encoder_tests.cpp
+
+eeprom_block_io_DEFS := -DEEPROM_TRANSIENT -DTRANSIENT_EEPROM_SIZE=4096 -DNO_PRINT
+
+eeprom_block_io_INC := \
+	$(TOP_DIR)/drivers/eeprom/
+
+eeprom_block_io_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_block_io_tests.cpp
@@ -0,0 +1,104 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "serial_loopback.h"
+#include "serial_protocol.h"
+
+#define SERIAL_LOOPBACK_QUEUE_SIZE 256
+
+typedef struct {
+    uint8_t data[SERIAL_LOOPBACK_QUEUE_SIZE];
+    size_t  head;
+    size_t  count;
+} serial_loopback_queue_t;
+
+// receive queues, indexed by whether the half is the initiator
+static serial_loopback_queue_t queues[2];
+static bool                    selected_initiator = true;
+
+static serial_loopback_queue_t *rx_queue(void) {
+    return &queues[selected_initiator];
+}
+
+static serial_loopback_queue_t *tx_queue(void) {
+    return &queues[!selected_initiator];
+}
+
+void serial_loopback_reset(void) {
+    memset(queues, 0, sizeof(queues));
+    selected_initiator = true;
+}
+
+void serial_loopback_select(bool initiator) {
+    selected_initiator = initiator;
+}
+
+size_t serial_loopback_pending(void) {
+    return rx_queue()->count;
+}
+
+void serial_loopback_drop(size_t count) {
+    serial_loopback_queue_t *queue = rx_queue();
+
+    if (count > queue->count) {
+        count = queue->count;
+    }
+    queue->head = (queue->head + count) % SERIAL_LOOPBACK_QUEUE_SIZE;
+    queue->count -= count;
+}
+
+void serial_loopback_corrupt(size_t offset) {
+    serial_loopback_queue_t *queue = rx_queue();
+
+    if (offset < queue->count) {
+        queue->data[(queue->head + offset) % SERIAL_LOOPBACK_QUEUE_SIZE] ^= 0xFF;
+    }
+}
+
+void serial_transport_driver_clear(void) {
+    serial_loopback_drop(SERIAL_LOOPBACK_QUEUE_SIZE);
+}
+
+void serial_transport_driver_slave_init(void) {
+    serial_loopback_select(false);
+}
+
+void serial_transport_driver_master_init(void) {
+    serial_loopback_select(true);
+}
+
+bool serial_transport_receive(uint8_t *destination, const size_t size) {
+    serial_loopback_queue_t *queue = rx_queue();
+
+    if (size > queue->count) {
+        return false;
+    }
+    for (size_t i = 0; i < size; i++) {
+        destination[i] = queue->data[(queue->head + i) % SERIAL_LOOPBACK_QUEUE_SIZE];
+    }
+    serial_loopback_drop(size);
+    return true;
+}
+
+bool serial_transport_receive_blocking(uint8_t *destination, const size_t size) {
+    return serial_transport_receive(destination, size);
+}
+
+bool serial_transport_receive_available(uint8_t *destination, const size_t size) {
+    return serial_transport_receive(destination, size);
+}
+
+bool serial_transport_send(const uint8_t *source, const size_t size) {
+    serial_loopback_queue_t *queue = tx_queue();
+
+    if (size > SERIAL_LOOPBACK_QUEUE_SIZE - queue->count) {
+        return false;
+    }
+    for (size_t i = 0; i < size; i++) {
+        queue->data[(queue->head + queue->count + i) % SERIAL_LOOPBACK_QUEUE_SIZE] = source[i];
+    }
+    queue->count += size;
+    return true;
+}
@@ -0,0 +1,23 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Loopback implementation of the serial_protocol.h driver functions. Both
+ * halves live in the same process, serial_loopback_select() decides which
+ * half the driver functions act on. Receives never wait, missing data fails
+ * like a timeout would. */
+
+void serial_loopback_reset(void);
+void serial_loopback_select(bool initiator);
+
+// number of bytes waiting to be received by the selected half
+size_t serial_loopback_pending(void);
+// throw away bytes waiting for the selected half, simulating a lost transmission
+void serial_loopback_drop(size_t count);
+// flip the bits of a byte waiting for the selected half, simulating a bit error
+void serial_loopback_corrupt(size_t offset);
@@ -0,0 +1,172 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "serial_matrix_push.h"
+#include "serial_protocol.h"
+#include "serial_loopback.h"
+}
+
+#define MATRIX_SIZE 4
+
+class SerialMatrixPush : public testing::Test {
+   protected:
+    void SetUp() override {
+        serial_loopback_reset();
+
+        /* The sequence numbers carry over between tests, bring both halves
+         * back in step with a notification the master always accepts. */
+        push(0x00);
+        pull();
+    }
+
+    bool push(uint8_t value) {
+        uint8_t matrix[MATRIX_SIZE];
+        memset(matrix, value, sizeof(matrix));
+        serial_transport_driver_slave_init();
+        bool okay = serial_matrix_push_send(matrix, sizeof(matrix));
+        serial_transport_driver_master_init();
+        return okay;
+    }
+
+    bool pull(void) {
+        serial_matrix_push_drain(MATRIX_SIZE);
+        return serial_matrix_push_collect(matrix, sizeof(matrix));
+    }
+
+    void expect_matrix(uint8_t value) {
+        for (uint8_t i = 0; i < MATRIX_SIZE; i++) {
+            EXPECT_EQ(matrix[i], value);
+        }
+    }
+
+    uint8_t matrix[MATRIX_SIZE] = {0};
+};
+
+TEST_F(SerialMatrixPush, ReceivesPushedMatrix) {
+    EXPECT_TRUE(push(0x12));
+    EXPECT_TRUE(pull());
+    expect_matrix(0x12);
+    EXPECT_EQ(serial_loopback_pending(), 0);
+}
+
+TEST_F(SerialMatrixPush, KeepsMatrixWithoutPush) {
+    push(0x34);
+    pull();
+
+    EXPECT_TRUE(pull());
+    expect_matrix(0x34);
+}
+
+TEST_F(SerialMatrixPush, LatestOfSeveralPushesWins) {
+    push(0x01);
+    push(0x02);
+    push(0x03);
+
+    EXPECT_TRUE(pull());
+    expect_matrix(0x03);
+}
+
+TEST_F(SerialMatrixPush, DroppedPushRequestsResync) {
+    push(0x01);
+    pull();
+
+    push(0x02);
+    serial_loopback_drop(MATRIX_SIZE + 3);
+    push(0x03);
+
+    EXPECT_FALSE(pull());
+    expect_matrix(0x01);
+
+    // Back in sequence with the next notification
+    push(0x04);
+    EXPECT_TRUE(pull());
+    expect_matrix(0x04);
+}
+
+TEST_F(SerialMatrixPush, CorruptedPushRequestsResync) {
+    push(0x01);
+    pull();
+
+    push(0x02);
+    serial_loopback_corrupt(2);
+
+    EXPECT_FALSE(pull());
+    expect_matrix(0x01);
+
+    push(0x03);
+    EXPECT_TRUE(pull());
+    expect_matrix(0x03);
+}
+
+TEST_F(SerialMatrixPush, TruncatedPushRequestsResync) {
+    push(0x01);
+    pull();
+
+    serial_transport_driver_slave_init();
+    uint8_t partial[] = {SERIAL_MATRIX_PUSH_MARKER, 0x00, 0x02};
+    serial_transport_send(partial, sizeof(partial));
+    serial_transport_driver_master_init();
+
+    EXPECT_FALSE(pull());
+    expect_matrix(0x01);
+}
+
+TEST_F(SerialMatrixPush, DrainDiscardsSpuriousBytes) {
+    serial_transport_driver_slave_init();
+    uint8_t noise[] = {0x00, 0x17, 0xFF};
+    serial_transport_send(noise, sizeof(noise));
+    serial_transport_driver_master_init();
+    push(0x56);
+
+    EXPECT_TRUE(pull());
+    expect_matrix(0x56);
+    EXPECT_EQ(serial_loopback_pending(), 0);
+}
+
+TEST_F(SerialMatrixPush, HandshakeAfterPush) {
+    uint8_t handshake = 0x23;
+
+    // Slave pushes a change right before it answers a transaction
+    push(0x78);
+    serial_transport_driver_slave_init();
+    serial_transport_send(&handshake, sizeof(handshake));
+    serial_transport_driver_master_init();
+
+    uint8_t received = 0xFF;
+    EXPECT_TRUE(serial_matrix_push_receive_handshake(&received, MATRIX_SIZE));
+    EXPECT_EQ(received, handshake);
+
+    EXPECT_TRUE(serial_matrix_push_collect(matrix, sizeof(matrix)));
+    expect_matrix(0x78);
+}
+
+TEST_F(SerialMatrixPush, HandshakeTimeout) {
+    push(0x78);
+
+    uint8_t received = 0xFF;
+    EXPECT_FALSE(serial_matrix_push_receive_handshake(&received, MATRIX_SIZE));
+
+    // The notification was still picked up
+    EXPECT_TRUE(serial_matrix_push_collect(matrix, sizeof(matrix)));
+    expect_matrix(0x78);
+}
+
+TEST_F(SerialMatrixPush, SequenceWrapsAround) {
+    for (uint16_t i = 0; i < 300; i++) {
+        push((uint8_t)i);
+        ASSERT_TRUE(pull());
+        expect_matrix((uint8_t)i);
+    }
+}
+
+TEST_F(SerialMatrixPush, RejectsOversizedMatrix) {
+    uint8_t large[SERIAL_MATRIX_PUSH_MAX_SIZE + 1] = {0};
+
+    serial_transport_driver_slave_init();
+    EXPECT_FALSE(serial_matrix_push_send(large, sizeof(large)));
+    serial_transport_driver_master_init();
+    EXPECT_EQ(serial_loopback_pending(), 0);
+}
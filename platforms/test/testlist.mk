@@ -1 +1 @@
-TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large
+TEST_LIST += eeprom_legacy_emulated_flash_tiny eeprom_legacy_emulated_flash_large serial_matrix_push ws2812_encoder eeprom_block_io
@@ -0,0 +1,103 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+typedef uint16_t ws2812_buffer_t;
+
+#define WS2812_DUTYCYCLE_0 29
+#define WS2812_DUTYCYCLE_1 75
+
+extern "C" {
+#include "ws2812_encoder.h"
+}
+
+#define LED_COUNT 64
+#define CHANNELS 3
+
+/* The per bit encoders the drivers used before, kept as the reference. */
+static uint8_t get_protocol_eq(uint8_t data, int pos) {
+    uint8_t eq = 0;
+    if (data & (1 << (2 * (3 - pos))))
+        eq = 0b1110;
+    else
+        eq = 0b1000;
+    if (data & (2 << (2 * (3 - pos))))
+        eq += 0b11100000;
+    else
+        eq += 0b10000000;
+    return eq;
+}
+
+static void reference_spi_encode(uint8_t *dest, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        for (int j = 0; j < 4; j++) {
+            dest[4 * i + j] = get_protocol_eq(data[i], j);
+        }
+    }
+}
+
+static void reference_pwm_encode(ws2812_buffer_t *dest, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            dest[8 * i + (7 - bit)] = ((data[i] >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        }
+    }
+}
+
+class Ws2812Encoder : public testing::Test {
+   protected:
+    void SetUp() override {
+        for (size_t i = 0; i < sizeof(colors); i++) {
+            colors[i] = (uint8_t)(i * 37 + 11);
+        }
+    }
+
+    uint8_t colors[LED_COUNT * CHANNELS];
+};
+
+TEST_F(Ws2812Encoder, SpiMatchesReferenceForEveryByte) {
+    for (int value = 0; value < 256; value++) {
+        uint8_t data = value;
+        uint8_t expected[WS2812_SPI_BYTES_PER_BYTE];
+        uint8_t actual[WS2812_SPI_BYTES_PER_BYTE];
+
+        reference_spi_encode(expected, &data, 1);
+        ws2812_spi_encode(actual, &data, 1);
+        EXPECT_EQ(memcmp(expected, actual, sizeof(actual)), 0) << "byte " << value;
+    }
+}
+
+TEST_F(Ws2812Encoder, PwmMatchesReferenceForEveryByte) {
+    for (int value = 0; value < 256; value++) {
+        uint8_t         data = value;
+        ws2812_buffer_t expected[8];
+        ws2812_buffer_t actual[8];
+
+        reference_pwm_encode(expected, &data, 1);
+        ws2812_pwm_encode(actual, &data, 1);
+        EXPECT_EQ(memcmp(expected, actual, sizeof(actual)), 0) << "byte " << value;
+    }
+}
+
+TEST_F(Ws2812Encoder, SpiEncodesWholeFrame) {
+    uint8_t expected[sizeof(colors) * WS2812_SPI_BYTES_PER_BYTE + 1];
+    uint8_t actual[sizeof(colors) * WS2812_SPI_BYTES_PER_BYTE + 1];
+
+    // The byte past the frame is left alone
+    expected[sizeof(expected) - 1] = actual[sizeof(actual) - 1] = 0x5A;
+    reference_spi_encode(expected, colors, sizeof(colors));
+    ws2812_spi_encode(actual, colors, sizeof(colors));
+    EXPECT_EQ(memcmp(expected, actual, sizeof(actual)), 0);
+}
+
+TEST_F(Ws2812Encoder, PwmEncodesWholeFrame) {
+    ws2812_buffer_t expected[sizeof(colors) * 8 + 1];
+    ws2812_buffer_t actual[sizeof(colors) * 8 + 1];
+
+    // The reset period after the frame is left alone
+    expected[sizeof(colors) * 8] = actual[sizeof(colors) * 8] = 0;
+    reference_pwm_encode(expected, colors, sizeof(colors));
+    ws2812_pwm_encode(actual, colors, sizeof(colors));
+    EXPECT_EQ(memcmp(expected, actual, sizeof(actual)), 0);
+}
@@ -44,6 +44,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "encoder.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 int tp_buttons;
 
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
@@ -76,6 +80,9 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
  * FIXME: Needs documentation.
  */
 void action_exec(keyevent_t event) {
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_action(&event);
+#endif
     if (IS_EVENT(event)) {
         ac_dprintf("\n---- action_exec: start -----\n");
         ac_dprintf("EVENT: ");
@@ -289,6 +296,9 @@ void process_record(keyrecord_t *record) {
 #ifdef FLOW_TAP_TERM
     flow_tap_update_last_event(record);
 #endif // FLOW_TAP_TERM
+#ifdef LATENCY_TRACE_ENABLE
+    uint8_t latency_trace_previous = latency_trace_process_begin(&record->event);
+#endif
 
     if (!process_record_quantum(record)) {
 #ifndef NO_ACTION_ONESHOT
@@ -296,11 +306,14 @@ void process_record(keyrecord_t *record) {
             clear_oneshot_layer_state(ONESHOT_OTHER_KEY_PRESSED);
         }
 #endif
-        return;
+    } else {
+        process_record_handler(record);
+        post_process_record_quantum(record);
     }
 
-    process_record_handler(record);
-    post_process_record_quantum(record);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_process_end(latency_trace_previous);
+#endif
 }
 
 void process_record_handler(keyrecord_t *record) {
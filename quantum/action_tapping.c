@@ -199,6 +199,24 @@ void action_tapping_process(keyrecord_t record) {
     }
 }
 
+/** \brief Time the tapping state machine can go without tick events
+ *
+ * Returns the number of milliseconds until the pending tap, if any, has to be
+ * resolved, zero if ticks are needed right away and UINT16_MAX when idle.
+ */
+uint16_t action_tapping_idle_time(void) {
+    if (waiting_buffer_head != waiting_buffer_tail) {
+        return 0;
+    }
+    if (!IS_EVENT(tapping_key.event)) {
+        return UINT16_MAX;
+    }
+
+    const uint16_t term    = GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key);
+    const uint16_t elapsed = TIMER_DIFF_16(timer_read(), tapping_key.event.time);
+    return elapsed < term ? term - elapsed : 0;
+}
+
 /* Some conditionally defined helper macros to keep process_tapping more
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
@@ -0,0 +1,61 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "audio_dds.h"
+
+void audio_dds_init(audio_dds_t *dds, const uint16_t *wavetable, size_t wavetable_length) {
+    dds->wavetable       = wavetable;
+    dds->wavetable_shift = 32;
+    for (size_t length = wavetable_length; length > 1; length >>= 1) {
+        dds->wavetable_shift--;
+    }
+
+    uint16_t min = UINT16_MAX, max = 0;
+    for (size_t i = 0; i < wavetable_length; i++) {
+        if (wavetable[i] < min) min = wavetable[i];
+        if (wavetable[i] > max) max = wavetable[i];
+    }
+    dds->center = (min + max + 1) / 2;
+
+    dds->voice_count = 0;
+    dds->offset      = 0;
+    dds->gain        = 0;
+    audio_dds_reset_phase(dds);
+}
+
+void audio_dds_set_voices(audio_dds_t *dds, const float *frequencies, uint8_t count, float sample_rate, uint16_t amplitude) {
+    if (count > AUDIO_DDS_MAX_VOICES) {
+        count = AUDIO_DDS_MAX_VOICES;
+    }
+    if (amplitude > AUDIO_DDS_AMPLITUDE_MAX) {
+        amplitude = AUDIO_DDS_AMPLITUDE_MAX;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        // the fraction of a period to step through per sample, anything at or above the sample rate aliases anyway
+        float step = frequencies[i] / sample_rate;
+        step -= (uint32_t)step;
+        // scaled in two halves, as a step rounding up to 1.0 would not fit the phase
+        dds->increment[i] = (uint32_t)(step * 2147483648.0f) << 1;
+    }
+
+    dds->voice_count = count;
+    dds->offset      = (int32_t)count * dds->center;
+    dds->gain        = count > 0 ? ((int32_t)amplitude << 8) / count : 0;
+}
+
+void audio_dds_reset_phase(audio_dds_t *dds) {
+    for (uint8_t i = 0; i < AUDIO_DDS_MAX_VOICES; i++) {
+        dds->phase[i] = 0;
+    }
+}
+
+uint16_t audio_dds_generate(audio_dds_t *dds) {
+    int32_t sum = 0;
+    for (uint8_t i = 0; i < dds->voice_count; i++) {
+        dds->phase[i] += dds->increment[i];
+        sum += dds->wavetable[dds->phase[i] >> dds->wavetable_shift];
+    }
+
+    return dds->center + (((sum - dds->offset) * dds->gain) >> 16);
+}
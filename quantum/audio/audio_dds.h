@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  Fixed-point direct digital synthesis
+
+  every voice steps a 32-bit phase accumulator through a shared wavetable, the top bits of the phase being the index
+  into the table; per-voice phase increments are worked out once whenever the tones change, so that generating a
+  sample takes only integer additions, shifts and a single multiply - cheap enough for the DMA callback of a DAC on
+  parts without an FPU
+*/
+
+/**
+ * The number of voices that can be mixed together.
+ */
+#ifndef AUDIO_DDS_MAX_VOICES
+#    define AUDIO_DDS_MAX_VOICES 8
+#endif
+
+/**
+ * Amplitude at which the voices are mixed over the full range of the wavetable.
+ */
+#define AUDIO_DDS_AMPLITUDE_MAX 256
+
+typedef struct {
+    const uint16_t *wavetable;
+    uint8_t         wavetable_shift; // turns a phase into an index into the wavetable
+    uint16_t        center;          // midpoint of the wavetable, which the mix is scaled around
+    uint8_t         voice_count;
+    int32_t         offset; // voice_count * center
+    int32_t         gain;   // amplitude / voice_count, in 1/65536ths
+    uint32_t        phase[AUDIO_DDS_MAX_VOICES];
+    uint32_t        increment[AUDIO_DDS_MAX_VOICES];
+} audio_dds_t;
+
+/**
+ * \brief Sets up the synthesizer with no voices.
+ *
+ * \param wavetable one period of the waveform, its length has to be a power of two
+ */
+void audio_dds_init(audio_dds_t *dds, const uint16_t *wavetable, size_t wavetable_length);
+
+/**
+ * \brief Sets the frequencies to play and their amplitude, keeping the phase of each voice.
+ *
+ * Only voices up to AUDIO_DDS_MAX_VOICES are played.
+ *
+ * \param sample_rate rate at which `audio_dds_generate()` is called, in Hz
+ * \param amplitude from 0 to AUDIO_DDS_AMPLITUDE_MAX
+ */
+void audio_dds_set_voices(audio_dds_t *dds, const float *frequencies, uint8_t count, float sample_rate, uint16_t amplitude);
+
+/**
+ * \brief Restarts every voice from the beginning of the wavetable.
+ */
+void audio_dds_reset_phase(audio_dds_t *dds);
+
+/**
+ * \brief Advances every voice by one sample and returns their mix.
+ */
+uint16_t audio_dds_generate(audio_dds_t *dds);
@@ -0,0 +1,149 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "audio_dds.h"
+}
+
+#define WAVETABLE_LENGTH 256
+#define SAMPLE_MAX 4095
+#define SAMPLE_RATE 44100.0f
+
+/* Renders the same voices as audio_dds_t, with double precision phases and exact mixing. */
+class ReferenceSynth {
+   public:
+    ReferenceSynth(const uint16_t *wavetable) : wavetable(wavetable) {}
+
+    void set_voices(const std::vector<float> &frequencies, float sample_rate, uint16_t amplitude) {
+        steps.clear();
+        for (float frequency : frequencies) {
+            steps.push_back((double)frequency / sample_rate);
+        }
+        phases.resize(steps.size(), 0.0);
+        this->amplitude = amplitude / (double)AUDIO_DDS_AMPLITUDE_MAX;
+    }
+
+    double generate(void) {
+        double sum = 0;
+        for (size_t i = 0; i < steps.size(); i++) {
+            phases[i] += steps[i];
+            phases[i] -= std::floor(phases[i]);
+            sum += wavetable[(size_t)(phases[i] * WAVETABLE_LENGTH)];
+        }
+        double center = (SAMPLE_MAX + 1) / 2;
+        return center + (sum - steps.size() * center) * amplitude / steps.size();
+    }
+
+   private:
+    const uint16_t     *wavetable;
+    std::vector<double> steps;
+    std::vector<double> phases;
+    double              amplitude = 1.0;
+};
+
+class AudioDds : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // one period of a sine wave, starting at its lowest point, like the DAC driver's
+        for (int i = 0; i < WAVETABLE_LENGTH; i++) {
+            wavetable[i] = (uint16_t)std::lround(SAMPLE_MAX / 2.0 * (1.0 - std::cos(2.0 * M_PI * i / WAVETABLE_LENGTH)));
+        }
+        audio_dds_init(&dds, wavetable, WAVETABLE_LENGTH);
+    }
+
+    void set_voices(const std::vector<float> &frequencies, uint16_t amplitude = AUDIO_DDS_AMPLITUDE_MAX) {
+        audio_dds_set_voices(&dds, frequencies.data(), frequencies.size(), SAMPLE_RATE, amplitude);
+        reference.set_voices(frequencies, SAMPLE_RATE, amplitude);
+    }
+
+    /* Renders a buffer and checks it against the reference, returning the samples. */
+    std::vector<uint16_t> render_and_compare(size_t length) {
+        std::vector<uint16_t> samples;
+        size_t                mismatches = 0;
+        for (size_t i = 0; i < length; i++) {
+            uint16_t sample   = audio_dds_generate(&dds);
+            double   expected = reference.generate();
+            samples.push_back(sample);
+
+            EXPECT_LE(sample, SAMPLE_MAX) << "at sample " << i;
+            // rounding of the mix
+            if (std::fabs(sample - expected) > 1.5) {
+                mismatches++;
+                // the phase landing on the other side of a wavetable step
+                EXPECT_LT(std::fabs(sample - expected), 60) << "at sample " << i;
+            }
+        }
+        EXPECT_LT(mismatches, length / 500) << "too many samples differ from the reference";
+        return samples;
+    }
+
+    uint16_t       wavetable[WAVETABLE_LENGTH];
+    audio_dds_t    dds;
+    ReferenceSynth reference{wavetable};
+};
+
+TEST_F(AudioDds, SilentWithoutVoices) {
+    EXPECT_EQ(audio_dds_generate(&dds), (SAMPLE_MAX + 1) / 2);
+
+    set_voices({});
+    EXPECT_EQ(audio_dds_generate(&dds), (SAMPLE_MAX + 1) / 2);
+}
+
+TEST_F(AudioDds, SingleToneMatchesReference) {
+    set_voices({440.0f});
+    auto samples = render_and_compare(SAMPLE_RATE);
+
+    // a second of samples holds as many periods as the frequency
+    int rising = 0;
+    for (size_t i = 1; i < samples.size(); i++) {
+        if (samples[i - 1] < (SAMPLE_MAX + 1) / 2 && samples[i] >= (SAMPLE_MAX + 1) / 2) {
+            rising++;
+        }
+    }
+    EXPECT_NEAR(rising, 440, 1);
+}
+
+TEST_F(AudioDds, ChordMatchesReference) {
+    set_voices({261.63f, 329.63f, 392.00f});
+    render_and_compare(SAMPLE_RATE / 4);
+
+    // changing the tones carries on from the current phase of each voice
+    set_voices({261.63f, 349.23f, 440.00f});
+    render_and_compare(SAMPLE_RATE / 4);
+}
+
+TEST_F(AudioDds, MixesUpToMaxVoices) {
+    std::vector<float> frequencies;
+    for (int i = 0; i < AUDIO_DDS_MAX_VOICES; i++) {
+        frequencies.push_back(110.0f * (i + 1));
+    }
+    set_voices(frequencies);
+    EXPECT_EQ(dds.voice_count, AUDIO_DDS_MAX_VOICES);
+    render_and_compare(SAMPLE_RATE / 4);
+
+    // any further voices are dropped
+    frequencies.push_back(7902.13f);
+    audio_dds_set_voices(&dds, frequencies.data(), frequencies.size(), SAMPLE_RATE, AUDIO_DDS_AMPLITUDE_MAX);
+    EXPECT_EQ(dds.voice_count, AUDIO_DDS_MAX_VOICES);
+}
+
+TEST_F(AudioDds, AmplitudeScalesAroundCenter) {
+    set_voices({440.0f, 660.0f}, AUDIO_DDS_AMPLITUDE_MAX / 4);
+    auto samples = render_and_compare(SAMPLE_RATE / 4);
+
+    for (uint16_t sample : samples) {
+        EXPECT_NEAR(sample, (SAMPLE_MAX + 1) / 2, (SAMPLE_MAX + 1) / 8 + 1);
+    }
+}
+
+TEST_F(AudioDds, HighFrequenciesWrap) {
+    // above the sample rate, a tone aliases onto the remainder
+    set_voices({SAMPLE_RATE + 1000.0f});
+    uint32_t increment = dds.increment[0];
+    set_voices({1000.0f});
+    EXPECT_NEAR(increment, dds.increment[0], 1024);
+}
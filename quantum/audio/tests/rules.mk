@@ -0,0 +1,5 @@
+VPATH += $(QUANTUM_PATH)/audio
+
+audio_dds_SRC := \
+	$(QUANTUM_PATH)/audio/audio_dds.c \
+	$(QUANTUM_PATH)/audio/tests/audio_dds_tests.cpp \
@@ -0,0 +1,2 @@
+TEST_LIST += \
+	audio_dds \
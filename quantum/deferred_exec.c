@@ -6,30 +6,105 @@
 #include <deferred_exec.h>
 
 #ifndef MAX_DEFERRED_EXECUTORS
-#    define MAX_DEFERRED_EXECUTORS 8
+#    if defined(__AVR__)
+#        define MAX_DEFERRED_EXECUTORS 8
+#    else
+#        define MAX_DEFERRED_EXECUTORS 16
+#    endif
 #endif
 
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap ordered by trigger time. Scheduled executors occupy the start of the table
+// with the earliest trigger time at index 0, and unused entries make up the remainder of the table.
+//
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline void clear_entry(deferred_executor_t *entry) {
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
+}
+
+static inline bool triggers_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline void swap_entries(deferred_executor_t *table, size_t a, size_t b) {
+    deferred_executor_t tmp = table[a];
+    table[a]                = table[b];
+    table[b]                = tmp;
+}
+
+// Number of scheduled executors, found by searching for the first unused entry
+static size_t scheduled_count(deferred_executor_t *table, size_t table_count) {
+    size_t low = 0, high = table_count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (table[mid].token != INVALID_DEFERRED_TOKEN) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// Restores the heap ordering after the trigger time of the entry at the supplied index has changed
+static void reheap(deferred_executor_t *table, size_t count, size_t index) {
+    // Move towards the top while earlier than the parent
+    while (index > 0 && triggers_before(&table[index], &table[(index - 1) / 2])) {
+        swap_entries(table, index, (index - 1) / 2);
+        index = (index - 1) / 2;
+    }
+
+    // Move towards the bottom while later than either child
+    while (true) {
+        size_t left     = 2 * index + 1;
+        size_t right    = left + 1;
+        size_t earliest = index;
+        if (left < count && triggers_before(&table[left], &table[earliest])) {
+            earliest = left;
+        }
+        if (right < count && triggers_before(&table[right], &table[earliest])) {
+            earliest = right;
+        }
+        if (earliest == index) {
+            break;
+        }
+        swap_entries(table, index, earliest);
+        index = earliest;
+    }
+}
+
+static void remove_entry(deferred_executor_t *table, size_t count, size_t index) {
+    size_t last = count - 1;
+    if (index != last) {
+        table[index] = table[last];
+        clear_entry(&table[last]);
+        reheap(table, last, index);
+    } else {
+        clear_entry(&table[last]);
     }
-    for (int i = 0; i < table_count; ++i) {
+}
+
+static inline bool find_token(deferred_executor_t *table, size_t count, deferred_token token, size_t *index) {
+    for (size_t i = 0; i < count; ++i) {
         if (table[i].token == token) {
-            return false;
+            *index = i;
+            return true;
         }
     }
-    return true;
+    return false;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
+static inline deferred_token allocate_token(deferred_executor_t *table, size_t count) {
     deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
+    size_t         unused;
+    while (current_token == INVALID_DEFERRED_TOKEN || find_token(table, count, current_token, &unused)) {
         ++current_token;
         if (current_token == first) {
             // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
@@ -49,27 +124,26 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+    // Claim the first unused slot, if any are available
+    size_t count = scheduled_count(table, table_count);
+    if (count == table_count) {
+        return INVALID_DEFERRED_TOKEN;
+    }
 
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token(table, count);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Set up the executor table entry, then move it into position
+    deferred_executor_t *entry = &table[count];
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    reheap(table, count + 1, count);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +153,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t count = scheduled_count(table, table_count);
+    size_t index;
+    if (!find_token(table, count, token, &index)) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[index].trigger_time = timer_read32() + delay_ms;
+    reheap(table, count, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,58 +172,70 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t count = scheduled_count(table, table_count);
+    size_t index;
+    if (!find_token(table, count, token, &index)) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    remove_entry(table, count, index);
+    return true;
+}
+
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+
+    // The earliest trigger time is always at the top of the heap
+    if (trigger_time) {
+        *trigger_time = table[0].trigger_time;
+    }
+    return true;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
+    if (!table || table_count == 0) {
+        return;
+    }
+
     uint32_t now = timer_read32();
 
     // Throttle only once per millisecond
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Execute whichever entry triggers earliest until it's in the future. An entry which is still due after being
+        // requeued may run again in this pass, but the total number of executions is capped at the number of entries
+        // that were scheduled beforehand, so that an executor falling behind cannot stall the main loop.
+        size_t runs = scheduled_count(table, table_count);
+        while (runs-- > 0 && table[0].token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(table[0].trigger_time, now)) <= 0) {
+            deferred_executor_t *entry      = &table[0];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+
+            // The callback may have scheduled, extended or cancelled entries, moving this one elsewhere in the table
+            size_t count = scheduled_count(table, table_count);
+            size_t index = 0;
+            if (table[0].token != curr_token && !find_token(table, count, curr_token, &index)) {
+                // The callback has cancelled (and possibly re-queued) itself. Skip further processing.
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                table[index].trigger_time += delay_ms;
+                reheap(table, count, index);
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                remove_entry(table, count, index);
             }
         }
     }
@@ -172,6 +257,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+bool deferred_exec_next_trigger(uint32_t *trigger_time) {
+    return deferred_exec_advanced_next_trigger(basic_executors, MAX_DEFERRED_EXECUTORS, trigger_time);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
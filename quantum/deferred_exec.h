@@ -60,6 +60,14 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Retrieves the time at which the earliest deferred execution is due, allowing the caller to work out how long it may idle for.
+ *
+ * @param trigger_time[out] the timer value at which the earliest deferred execution is due, may be NULL if unused
+ * @return true if any deferred executions are scheduled, otherwise false
+ */
+bool deferred_exec_next_trigger(uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -110,6 +118,16 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Retrieves the time at which the earliest deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @param trigger_time[out] the timer value at which the earliest deferred execution is due, may be NULL if unused
+ * @return true if any deferred executions are scheduled in the table, otherwise false
+ */
+bool deferred_exec_advanced_next_trigger(deferred_executor_t *table, size_t table_count, uint32_t *trigger_time);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
@@ -15,12 +15,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
 #include "send_string.h"
 #include "keycodes.h"
 #include "nvm_dynamic_keymap.h"
+#include "util.h"
 
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
@@ -32,6 +34,23 @@
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+// Streamed writes are only staged in RAM for VIA, unless a buffer size is given
+#ifndef DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE
+#    if !defined(VIA_ENABLE)
+#        define DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE 0
+#    elif defined(__AVR__)
+#        define DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE 32
+#    else
+#        define DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE 256
+#    endif
+#endif
+
+#if DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE > 0
+static uint8_t  stream_buffer[DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE];
+static uint16_t stream_offset = 0;
+static uint16_t stream_length = 0;
+#endif
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -41,6 +60,7 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
 }
 
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+    dynamic_keymap_stream_commit();
     nvm_dynamic_keymap_update_keycode(layer, row, column, keycode);
 }
 
@@ -55,6 +75,11 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
 #endif // ENCODER_MAP_ENABLE
 
 void dynamic_keymap_reset(void) {
+#if DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE > 0
+    // Drop whatever was still being streamed, it would be overwritten anyway.
+    stream_length = 0;
+#endif
+
     // Erase the keymaps, if necessary.
     nvm_dynamic_keymap_erase();
 
@@ -75,11 +100,49 @@ void dynamic_keymap_reset(void) {
 }
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    dynamic_keymap_stream_commit();
     nvm_dynamic_keymap_read_buffer(offset, size, data);
 }
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    dynamic_keymap_stream_commit();
+    nvm_dynamic_keymap_update_buffer(offset, size, data);
+}
+
+void dynamic_keymap_stream_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+#if DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE > 0
+    if (stream_length > 0 && offset != stream_offset + stream_length) {
+        dynamic_keymap_stream_commit();
+    }
+
+    while (size > 0) {
+        if (stream_length == 0) {
+            stream_offset = offset;
+        }
+
+        uint16_t length = MIN(size, DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE - stream_length);
+        memcpy(&stream_buffer[stream_length], data, length);
+        stream_length += length;
+        offset += length;
+        data += length;
+        size -= length;
+
+        if (stream_length == DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE) {
+            dynamic_keymap_stream_commit();
+        }
+    }
+#else
     nvm_dynamic_keymap_update_buffer(offset, size, data);
+#endif
+}
+
+void dynamic_keymap_stream_commit(void) {
+#if DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE > 0
+    if (stream_length > 0) {
+        nvm_dynamic_keymap_update_buffer(stream_offset, stream_length, stream_buffer);
+        stream_length = 0;
+    }
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -45,6 +45,17 @@ void dynamic_keymap_reset(void);
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 
+// Streamed writes to the same buffer, for host applications writing a whole keymap.
+// Consecutive writes are staged in RAM and written to EEPROM a block of
+// DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE bytes at a time instead of one packet at a time.
+// Without a buffer, which is the default when VIA is disabled, each write goes straight to EEPROM.
+// The remainder is written by dynamic_keymap_stream_commit(), or before the next
+// write that doesn't follow on, or the next dynamic_keymap_get_buffer(),
+// dynamic_keymap_set_buffer(), dynamic_keymap_set_keycode() or dynamic_keymap_reset().
+// Keys keep their previous keycodes until their part of the stream is written.
+void dynamic_keymap_stream_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+void dynamic_keymap_stream_commit(void);
+
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
 
@@ -167,6 +167,9 @@ void eeconfig_init_quantum(void) {
     extern void eeconfig_force_flush_led_matrix(void);
     eeconfig_force_flush_led_matrix();
 #endif // LED_MATRIX_ENABLE
+
+    // Don't leave a freshly initialised eeconfig half written
+    eeconfig_flush();
 }
 
 void eeconfig_init(void) {
@@ -177,6 +180,18 @@ void eeconfig_enable(void) {
     nvm_eeconfig_enable();
 }
 
+void eeconfig_flush(void) {
+#ifdef EECONFIG_WRITE_BACK
+    nvm_eeconfig_flush();
+#endif // EECONFIG_WRITE_BACK
+}
+
+void eeconfig_task(void) {
+#ifdef EECONFIG_WRITE_BACK
+    nvm_eeconfig_task();
+#endif // EECONFIG_WRITE_BACK
+}
+
 void eeconfig_disable(void) {
     nvm_eeconfig_disable();
 }
@@ -63,6 +63,15 @@ void eeconfig_init_user(void);
 void eeconfig_enable(void);
 void eeconfig_disable(void);
 
+/**
+ * \brief Write back the updates buffered with EECONFIG_WRITE_BACK.
+ *
+ * eeconfig_task() writes a chunk at a time once the keyboard is idle,
+ * eeconfig_flush() writes everything at once.
+ */
+void eeconfig_flush(void);
+void eeconfig_task(void);
+
 typedef union debug_config_t debug_config_t;
 void                         eeconfig_read_debug(debug_config_t *debug_config) __attribute__((nonnull));
 void                         eeconfig_update_debug(const debug_config_t *debug_config) __attribute__((nonnull));
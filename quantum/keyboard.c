@@ -34,6 +34,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "eeconfig.h"
 #include "action_layer.h"
 #include "suspend.h"
+#include "profiling.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -112,6 +113,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -136,6 +140,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LEADER_ENABLE
 #    include "leader.h"
 #endif
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 #ifdef UNICODE_COMMON_ENABLE
 #    include "unicode.h"
 #endif
@@ -148,6 +155,17 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#ifdef MATRIX_IDLE_SLEEP
+#    include "idle_sleep.h"
+#    include "action.h"
+#    include "action_tapping.h"
+#    ifdef DEFERRED_EXEC_ENABLE
+#        include "deferred_exec.h"
+#    endif
+#    ifndef MATRIX_IDLE_SLEEP_TIMEOUT
+#        define MATRIX_IDLE_SLEEP_TIMEOUT 20
+#    endif
+#endif
 #ifdef CONNECTION_ENABLE
 #    include "connection.h"
 #endif
@@ -225,6 +243,12 @@ uint32_t get_matrix_scan_rate(void) {
 }
 #else
 #    define matrix_scan_perf_task()
+#    ifdef PROFILING_ENABLE
+uint32_t get_matrix_scan_rate(void) {
+    uint32_t elapsed = profiling_elapsed();
+    return elapsed ? (uint64_t)profiling_get_stats(PROFILING_TASK_MATRIX)->count * 1000 / elapsed : 0;
+}
+#    endif
 #endif
 
 #ifdef MATRIX_HAS_GHOST
@@ -421,6 +445,12 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#ifdef EECONFIG_WRITE_BACK
+    eeconfig_task();
+#endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_INCREMENTAL_CONSOLIDATION)
+    wear_leveling_task();
+#endif
     housekeeping_task_modules();
     housekeeping_task_kb();
     housekeeping_task_user();
@@ -629,6 +659,9 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress && !keypress_is_wakeup_key(row, col)) {
+#ifdef LATENCY_TRACE_ENABLE
+                    latency_trace_matrix(row, col, key_pressed);
+#endif
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
                 }
 
@@ -710,50 +743,73 @@ void quantum_task(void) {
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    PROFILING_BEGIN(PROFILING_TASK_MATRIX);
+    bool matrix_changed = matrix_task();
+    PROFILING_END(PROFILING_TASK_MATRIX);
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
+    PROFILING_BEGIN(PROFILING_TASK_QUANTUM);
     quantum_task();
+    PROFILING_END(PROFILING_TASK_QUANTUM);
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
+    PROFILING_BEGIN(PROFILING_TASK_SPLIT_WATCHDOG);
     split_watchdog_task();
+    PROFILING_END(PROFILING_TASK_SPLIT_WATCHDOG);
 #endif
 
 #if defined(RGBLIGHT_ENABLE)
+    PROFILING_BEGIN(PROFILING_TASK_RGBLIGHT);
     rgblight_task();
+    PROFILING_END(PROFILING_TASK_RGBLIGHT);
 #endif
 
 #ifdef LED_MATRIX_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_LED_MATRIX);
     led_matrix_task();
+    PROFILING_END(PROFILING_TASK_LED_MATRIX);
 #endif
 #ifdef RGB_MATRIX_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_RGB_MATRIX);
     rgb_matrix_task();
+    PROFILING_END(PROFILING_TASK_RGB_MATRIX);
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
 #    if defined(BACKLIGHT_PIN) || defined(BACKLIGHT_PINS)
+    PROFILING_BEGIN(PROFILING_TASK_BACKLIGHT);
     backlight_task();
+    PROFILING_END(PROFILING_TASK_BACKLIGHT);
 #    endif
 #endif
 
 #ifdef ENCODER_ENABLE
-    if (encoder_task()) {
+    PROFILING_BEGIN(PROFILING_TASK_ENCODER);
+    bool encoder_changed = encoder_task();
+    PROFILING_END(PROFILING_TASK_ENCODER);
+    if (encoder_changed) {
         last_encoder_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef POINTING_DEVICE_ENABLE
-    if (pointing_device_task()) {
+    PROFILING_BEGIN(PROFILING_TASK_POINTING_DEVICE);
+    bool pointing_device_changed = pointing_device_task();
+    PROFILING_END(PROFILING_TASK_POINTING_DEVICE);
+    if (pointing_device_changed) {
         last_pointing_device_activity_trigger();
         activity_has_occurred = true;
     }
 #endif
 
 #ifdef OLED_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_OLED);
     oled_task();
+    PROFILING_END(PROFILING_TASK_OLED);
 #    if OLED_TIMEOUT > 0
     // Wake up oled if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) oled_on();
@@ -761,7 +817,9 @@ void keyboard_task(void) {
 #endif
 
 #ifdef ST7565_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_ST7565);
     st7565_task();
+    PROFILING_END(PROFILING_TASK_ST7565);
 #    if ST7565_TIMEOUT > 0
     // Wake up display if user is using those fabulous keys or spinning those encoders!
     if (activity_has_occurred) st7565_on();
@@ -770,36 +828,132 @@ void keyboard_task(void) {
 
 #ifdef MOUSEKEY_ENABLE
     // mousekey repeat & acceleration
+    PROFILING_BEGIN(PROFILING_TASK_MOUSEKEY);
     mousekey_task();
+    PROFILING_END(PROFILING_TASK_MOUSEKEY);
 #endif
 
 #ifdef PS2_MOUSE_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_PS2_MOUSE);
     ps2_mouse_task();
+    PROFILING_END(PROFILING_TASK_PS2_MOUSE);
 #endif
 
 #ifdef MIDI_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_MIDI);
     midi_task();
+    PROFILING_END(PROFILING_TASK_MIDI);
 #endif
 
 #ifdef JOYSTICK_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_JOYSTICK);
     joystick_task();
+    PROFILING_END(PROFILING_TASK_JOYSTICK);
 #endif
 
 #ifdef BATTERY_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_BATTERY);
     battery_task();
+    PROFILING_END(PROFILING_TASK_BATTERY);
 #endif
 
 #ifdef BLUETOOTH_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_BLUETOOTH);
     bluetooth_task();
+    PROFILING_END(PROFILING_TASK_BLUETOOTH);
 #endif
 
 #ifdef HAPTIC_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_HAPTIC);
     haptic_task();
+    PROFILING_END(PROFILING_TASK_HAPTIC);
 #endif
 
+    PROFILING_BEGIN(PROFILING_TASK_LED);
     led_task();
+    PROFILING_END(PROFILING_TASK_LED);
 
 #ifdef OS_DETECTION_ENABLE
+    PROFILING_BEGIN(PROFILING_TASK_OS_DETECTION);
     os_detection_task();
+    PROFILING_END(PROFILING_TASK_OS_DETECTION);
 #endif
 }
+
+#ifdef MATRIX_IDLE_SLEEP
+/** \brief idle_sleep_allowed_kb
+ *
+ * Override this function to keep the main loop awake, e.g. while animating.
+ * This is specific to keyboard-level functionality.
+ */
+__attribute__((weak)) bool idle_sleep_allowed_kb(void) {
+    return idle_sleep_allowed_user();
+}
+
+/** \brief idle_sleep_allowed_user
+ *
+ * Override this function to keep the main loop awake, e.g. while animating.
+ * This is specific to user/keymap-level functionality.
+ */
+__attribute__((weak)) bool idle_sleep_allowed_user(void) {
+    return true;
+}
+
+// Fallbacks for matrix implementations that cannot idle
+__attribute__((weak)) bool matrix_idle_arm(void) {
+    return false;
+}
+__attribute__((weak)) void matrix_idle_disarm(void) {}
+
+/** \brief keyboard_idle_sleep_time
+ *
+ * Works out how long the main loop may sleep for: zero while a key is down or
+ * when encoders or a pointing device are enabled, otherwise up to MATRIX_IDLE_SLEEP_TIMEOUT, cut short by any pending tap or
+ * deferred executor.
+ */
+uint32_t keyboard_idle_sleep_time(void) {
+#    if defined(ENCODER_ENABLE) || defined(POINTING_DEVICE_ENABLE)
+    // Encoders and pointing devices are polled and cannot wake the loop, so
+    // sleeping would drop encoder steps and slow down pointer motion
+    return 0;
+#    endif
+#    ifdef SPLIT_KEYBOARD
+    // The master has to keep polling the other half
+    if (is_keyboard_master()) return 0;
+#    endif
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (matrix_previous[row] || matrix_get_row(row)) {
+            return 0;
+        }
+    }
+
+    uint32_t timeout = MATRIX_IDLE_SLEEP_TIMEOUT;
+#    ifndef NO_ACTION_TAPPING
+    timeout = MIN(timeout, action_tapping_idle_time());
+#    endif
+#    ifdef DEFERRED_EXEC_ENABLE
+    uint32_t next_trigger;
+    if (deferred_exec_next_trigger(&next_trigger)) {
+        int32_t remaining = (int32_t)TIMER_DIFF_32(next_trigger, timer_read32());
+        timeout           = remaining > 0 ? MIN(timeout, (uint32_t)remaining) : 0;
+    }
+#    endif
+
+    if (timeout > 0 && !idle_sleep_allowed_kb()) {
+        return 0;
+    }
+    return timeout;
+}
+
+/** \brief keyboard_idle_sleep_task
+ *
+ * Sleeps the main loop until a key is pressed or something is due.
+ */
+void keyboard_idle_sleep_task(void) {
+    uint32_t timeout = keyboard_idle_sleep_time();
+    if (timeout > 0 && matrix_idle_arm()) {
+        idle_sleep(timeout);
+    }
+}
+#endif // MATRIX_IDLE_SLEEP
@@ -139,6 +139,13 @@ void set_activity_timestamps(uint32_t matrix_timestamp, uint32_t encoder_timesta
 
 uint32_t get_matrix_scan_rate(void);
 
+#ifdef MATRIX_IDLE_SLEEP
+bool     idle_sleep_allowed_kb(void);    // To be overridden by keyboard-level code
+bool     idle_sleep_allowed_user(void);  // To be overridden by user/keymap-level code
+uint32_t keyboard_idle_sleep_time(void); // Number of milliseconds the main loop may currently sleep for
+void     keyboard_idle_sleep_task(void); // To be executed by the main loop after all other tasks
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,164 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "latency_trace.h"
+#include "timer.h"
+#include "print.h"
+
+#define NO_TRACE 0xFF
+
+static latency_trace_t traces[LATENCY_TRACE_SIZE];
+static uint8_t         trace_head    = 0;
+static uint8_t         trace_count   = 0;
+static uint8_t         trace_current = NO_TRACE; // trace of the record being processed
+
+__attribute__((weak)) uint32_t latency_trace_timestamp(void) {
+    return timer_read32();
+}
+
+static void stamp(latency_trace_t *trace, latency_stage_t stage, uint32_t now) {
+    trace->timestamp[stage] = now;
+    trace->stages |= 1 << stage;
+}
+
+static uint8_t trace_slot(uint8_t index) {
+    return (trace_head + LATENCY_TRACE_SIZE - trace_count + index) % LATENCY_TRACE_SIZE;
+}
+
+/* Oldest trace of the key event still waiting for the given stage. */
+static uint8_t find_waiting(keypos_t key, bool pressed, latency_stage_t stage) {
+    for (uint8_t i = 0; i < trace_count; i++) {
+        uint8_t          slot  = trace_slot(i);
+        latency_trace_t *trace = &traces[slot];
+        if (trace->open && trace->pressed == pressed && KEYEQ(trace->key, key) && !(trace->stages & (1 << stage))) {
+            return slot;
+        }
+    }
+    return NO_TRACE;
+}
+
+void latency_trace_matrix(uint8_t row, uint8_t col, bool pressed) {
+    latency_trace_t *trace = &traces[trace_head];
+
+    memset(trace, 0, sizeof(*trace));
+    trace->key     = (keypos_t){.row = row, .col = col};
+    trace->pressed = pressed;
+    trace->open    = true;
+    stamp(trace, LATENCY_STAGE_MATRIX, latency_trace_timestamp());
+
+    trace_head = (trace_head + 1) % LATENCY_TRACE_SIZE;
+    if (trace_count < LATENCY_TRACE_SIZE) {
+        trace_count++;
+    }
+}
+
+void latency_trace_action(const keyevent_t *event) {
+    if (event->type != KEY_EVENT) {
+        return;
+    }
+
+    uint8_t slot = find_waiting(event->key, event->pressed, LATENCY_STAGE_ACTION);
+    if (slot != NO_TRACE) {
+        stamp(&traces[slot], LATENCY_STAGE_ACTION, latency_trace_timestamp());
+    }
+}
+
+uint8_t latency_trace_process_begin(const keyevent_t *event) {
+    uint8_t previous = trace_current;
+
+    trace_current = NO_TRACE;
+    if (event->type == KEY_EVENT) {
+        trace_current = find_waiting(event->key, event->pressed, LATENCY_STAGE_PROCESS);
+        if (trace_current != NO_TRACE) {
+            stamp(&traces[trace_current], LATENCY_STAGE_PROCESS, latency_trace_timestamp());
+        }
+    }
+
+    return previous;
+}
+
+void latency_trace_process_end(uint8_t previous) {
+    if (trace_current != NO_TRACE && !traces[trace_current].pressed) {
+        // Once released, neither the release nor the press will send anything more
+        keypos_t key = traces[trace_current].key;
+        for (uint8_t i = 0; i < trace_count; i++) {
+            latency_trace_t *trace = &traces[trace_slot(i)];
+            if (KEYEQ(trace->key, key)) {
+                trace->open = false;
+            }
+        }
+    }
+
+    trace_current = previous;
+}
+
+void latency_trace_report(void) {
+    uint32_t now = latency_trace_timestamp();
+
+    for (uint8_t i = 0; i < trace_count; i++) {
+        latency_trace_t *trace = &traces[trace_slot(i)];
+        if (!trace->open) {
+            continue;
+        }
+
+        // While a record is processed, the report belongs to it, and to the
+        // press of the same key when that waited for the release
+        if (trace_current != NO_TRACE) {
+            const latency_trace_t *current = &traces[trace_current];
+            if (trace != current && !(trace->pressed && KEYEQ(trace->key, current->key))) {
+                continue;
+            }
+        }
+
+        stamp(trace, LATENCY_STAGE_REPORT, now);
+        trace->open = false;
+    }
+}
+
+uint8_t latency_trace_count(void) {
+    return trace_count;
+}
+
+const latency_trace_t *latency_trace_get(uint8_t index) {
+    return index < trace_count ? &traces[trace_slot(index)] : NULL;
+}
+
+const latency_trace_t *latency_trace_find(keypos_t key, bool pressed) {
+    for (uint8_t i = trace_count; i > 0; i--) {
+        const latency_trace_t *trace = &traces[trace_slot(i - 1)];
+        if (trace->pressed == pressed && KEYEQ(trace->key, key)) {
+            return trace;
+        }
+    }
+    return NULL;
+}
+
+uint32_t latency_trace_latency(const latency_trace_t *trace, latency_stage_t stage) {
+    if (!trace || !(trace->stages & (1 << stage))) {
+        return UINT32_MAX;
+    }
+    return trace->timestamp[stage] - trace->timestamp[LATENCY_STAGE_MATRIX];
+}
+
+void latency_trace_clear(void) {
+    trace_head    = 0;
+    trace_count   = 0;
+    trace_current = NO_TRACE;
+}
+
+void latency_trace_print(void) {
+    __attribute__((unused)) static const char *const stage_names[LATENCY_STAGE_COUNT] = {"matrix", "action", "process", "report"};
+
+    for (uint8_t i = 0; i < trace_count; i++) {
+        const latency_trace_t *trace = latency_trace_get(i);
+
+        uprintf("latency %u,%u %s:", trace->key.row, trace->key.col, trace->pressed ? "down" : "up");
+        for (uint8_t stage = LATENCY_STAGE_ACTION; stage < LATENCY_STAGE_COUNT; stage++) {
+            if (trace->stages & (1 << stage)) {
+                uprintf(" %s +%lu", stage_names[stage], (unsigned long)latency_trace_latency(trace, stage));
+            }
+        }
+        uprintf("%s\n", trace->open ? " (waiting)" : "");
+    }
+}
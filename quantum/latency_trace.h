@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+/*
+    Key latency tracer, enabled with LATENCY_TRACE_ENABLE = yes.
+
+    Every key event is timestamped as it moves through the stages below, and
+    kept in a ring buffer of the most recent LATENCY_TRACE_SIZE events:
+
+        MATRIX   change seen by matrix_task()
+        ACTION   handed to action_exec()
+        PROCESS  reaches process_record(), after the tapping and combo buffers
+        REPORT   keyboard report handed to the host driver
+
+    A report sent while a traced record is processed belongs to that record.
+    Reports sent at any other time, such as a tap-hold or auto shift timeout
+    or a combo firing, belong to every event still waiting for one.
+*/
+
+#ifndef LATENCY_TRACE_SIZE
+#    define LATENCY_TRACE_SIZE 16
+#endif
+
+typedef enum latency_stage_t {
+    LATENCY_STAGE_MATRIX,
+    LATENCY_STAGE_ACTION,
+    LATENCY_STAGE_PROCESS,
+    LATENCY_STAGE_REPORT,
+    LATENCY_STAGE_COUNT,
+} latency_stage_t;
+
+typedef struct latency_trace_t {
+    keypos_t key;
+    bool     pressed;
+    bool     open;   // still waiting for a report
+    uint8_t  stages; // bitmask of the stages reached
+    uint32_t timestamp[LATENCY_STAGE_COUNT];
+} latency_trace_t;
+
+/**
+ * \brief Timestamp the stages are recorded with.
+ *
+ * Defaults to the millisecond timer, can be overridden with a higher
+ * resolution source.
+ */
+uint32_t latency_trace_timestamp(void);
+
+void    latency_trace_matrix(uint8_t row, uint8_t col, bool pressed);
+void    latency_trace_action(const keyevent_t *event);
+uint8_t latency_trace_process_begin(const keyevent_t *event);
+void    latency_trace_process_end(uint8_t previous);
+void    latency_trace_report(void);
+
+/**
+ * \brief Number of traces held, at most LATENCY_TRACE_SIZE.
+ */
+uint8_t latency_trace_count(void);
+
+/**
+ * \brief Get a trace, 0 being the oldest held.
+ */
+const latency_trace_t *latency_trace_get(uint8_t index);
+
+/**
+ * \brief Find the most recent trace of a key event.
+ */
+const latency_trace_t *latency_trace_find(keypos_t key, bool pressed);
+
+/**
+ * \brief Time from the matrix change to the given stage.
+ *
+ * \return the latency, or UINT32_MAX if the stage was not reached.
+ */
+uint32_t latency_trace_latency(const latency_trace_t *trace, latency_stage_t stage);
+
+void latency_trace_clear(void);
+void latency_trace_print(void);
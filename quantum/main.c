@@ -15,6 +15,7 @@
  */
 
 #include "keyboard.h"
+#include "profiling.h"
 
 void platform_setup(void);
 
@@ -46,32 +47,60 @@ int main(void) {
 
     /* Main loop */
     while (true) {
+        PROFILING_BEGIN(PROFILING_TASK_LOOP);
         protocol_pre_task();
+#ifdef QUANTUM_PAINTER_ENABLE
+        // Release the bus from pixel data drawn in the background, before the keyboard task's devices need it
+        void qp_comms_task(void);
+        qp_comms_task();
+#endif
         protocol_keyboard_task();
         protocol_post_task();
 
 #ifdef RAW_ENABLE
         void raw_hid_task(void);
+        PROFILING_BEGIN(PROFILING_TASK_RAW_HID);
         raw_hid_task();
+        PROFILING_END(PROFILING_TASK_RAW_HID);
 #endif
 
 #ifdef CONSOLE_ENABLE
         void console_task(void);
+        PROFILING_BEGIN(PROFILING_TASK_CONSOLE);
         console_task();
+        PROFILING_END(PROFILING_TASK_CONSOLE);
 #endif
 
 #ifdef QUANTUM_PAINTER_ENABLE
         // Run Quantum Painter task
         void qp_internal_task(void);
+        PROFILING_BEGIN(PROFILING_TASK_QUANTUM_PAINTER);
         qp_internal_task();
+        PROFILING_END(PROFILING_TASK_QUANTUM_PAINTER);
 #endif
 
 #ifdef DEFERRED_EXEC_ENABLE
         // Run deferred executions
         void deferred_exec_task(void);
+        PROFILING_BEGIN(PROFILING_TASK_DEFERRED_EXEC);
         deferred_exec_task();
+        PROFILING_END(PROFILING_TASK_DEFERRED_EXEC);
 #endif // DEFERRED_EXEC_ENABLE
 
+        PROFILING_BEGIN(PROFILING_TASK_HOUSEKEEPING);
         housekeeping_task();
+        PROFILING_END(PROFILING_TASK_HOUSEKEEPING);
+
+        // Time spent idle below is deliberately left out of the loop
+        PROFILING_END(PROFILING_TASK_LOOP);
+
+#ifdef PROFILING_ENABLE
+        profiling_task();
+#endif
+
+#ifdef MATRIX_IDLE_SLEEP
+        // Sleep until the next key press or pending deadline
+        keyboard_idle_sleep_task();
+#endif // MATRIX_IDLE_SLEEP
     }
 }
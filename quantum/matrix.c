@@ -308,6 +308,86 @@ void matrix_init(void) {
     matrix_init_kb();
 }
 
+#if defined(MATRIX_IDLE_SLEEP) && !defined(DIRECT_PINS) && defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+#    include "idle_sleep.h"
+
+#    define MATRIX_IDLE_SLEEP_SUPPORTED
+#    if (DIODE_DIRECTION == COL2ROW)
+#        define idle_select_line(x) select_row(x)
+#        define idle_unselect_lines() unselect_rows()
+#        define IDLE_SELECT_LINES MATRIX_ROWS_PER_HAND
+#        define IDLE_INPUT_LINES MATRIX_COLS
+#        define idle_input_pins col_pins
+#    else
+#        define idle_select_line(x) select_col(x)
+#        define idle_unselect_lines() unselect_cols()
+#        define IDLE_SELECT_LINES MATRIX_COLS
+#        define IDLE_INPUT_LINES MATRIX_ROWS_PER_HAND
+#        define idle_input_pins row_pins
+#    endif
+
+static bool matrix_idle_armed = false;
+
+static bool matrix_idle_input_active(void) {
+    for (uint8_t x = 0; x < IDLE_INPUT_LINES; x++) {
+        if (readMatrixPin(idle_input_pins[x]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Puts the matrix into its idle state
+ *
+ * Drives every select line at once and arms wake interrupts on the inputs, so
+ * any key press shows up on a single read of the inputs. Returns false if a
+ * key is already down.
+ */
+bool matrix_idle_arm(void) {
+    if (matrix_idle_armed) {
+        return true;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS_PER_HAND; row++) {
+        if (raw_matrix[row]) {
+            return false;
+        }
+    }
+
+    for (uint8_t x = 0; x < IDLE_SELECT_LINES; x++) {
+        idle_select_line(x);
+    }
+    for (uint8_t x = 0; x < IDLE_INPUT_LINES; x++) {
+        if (idle_input_pins[x] != NO_PIN) {
+            idle_sleep_wake_pin_enable(idle_input_pins[x]);
+        }
+    }
+    matrix_idle_armed = true;
+    matrix_output_select_delay();
+
+    // a key pressed while arming may not have raised an interrupt
+    if (matrix_idle_input_active()) {
+        matrix_idle_disarm();
+        return false;
+    }
+    return true;
+}
+
+/** \brief Returns the matrix to regular scanning */
+void matrix_idle_disarm(void) {
+    if (!matrix_idle_armed) {
+        return;
+    }
+    for (uint8_t x = 0; x < IDLE_INPUT_LINES; x++) {
+        if (idle_input_pins[x] != NO_PIN) {
+            idle_sleep_wake_pin_disable(idle_input_pins[x]);
+        }
+    }
+    idle_unselect_lines();
+    matrix_output_unselect_delay(0, true);
+    matrix_idle_armed = false;
+}
+#endif // MATRIX_IDLE_SLEEP
+
 #ifdef SPLIT_KEYBOARD
 // Fallback implementation for keyboards not using the standard split_util.c
 __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -316,9 +396,7 @@ __attribute__((weak)) bool transport_master_if_connected(matrix_row_t master_mat
 }
 #endif
 
-uint8_t matrix_scan(void) {
-    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
-
+static void matrix_read(matrix_row_t curr_matrix[]) {
 #if defined(DIRECT_PINS) || (DIODE_DIRECTION == COL2ROW)
     // Set row, read cols
     for (uint8_t current_row = 0; current_row < MATRIX_ROWS_PER_HAND; current_row++) {
@@ -331,6 +409,23 @@ uint8_t matrix_scan(void) {
         matrix_read_rows_on_col(curr_matrix, current_col, row_shifter);
     }
 #endif
+}
+
+uint8_t matrix_scan(void) {
+    matrix_row_t curr_matrix[MATRIX_ROWS] = {0};
+
+#ifdef MATRIX_IDLE_SLEEP_SUPPORTED
+    // While idle nothing can have changed unless one of the inputs is active,
+    // in which case go back to scanning line by line.
+    if (matrix_idle_armed && matrix_idle_input_active()) {
+        matrix_idle_disarm();
+    }
+    if (!matrix_idle_armed) {
+        matrix_read(curr_matrix);
+    }
+#else
+    matrix_read(curr_matrix);
+#endif
 
     bool changed = memcmp(raw_matrix, curr_matrix, sizeof(curr_matrix)) != 0;
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
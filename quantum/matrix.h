@@ -81,6 +81,13 @@ void matrix_scan_kb(void);
 void matrix_init_user(void);
 void matrix_scan_user(void);
 
+#ifdef MATRIX_IDLE_SLEEP
+/* drive the matrix so that any key press can wake the keyboard, false if not possible */
+bool matrix_idle_arm(void);
+/* return from the idle state to regular scanning */
+void matrix_idle_disarm(void);
+#endif
+
 #ifdef SPLIT_KEYBOARD
 bool matrix_post_scan(void);
 void matrix_slave_scan_kb(void);
@@ -1,6 +1,7 @@
 // Copyright 2024 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "compiler_support.h"
 #include "keycodes.h"
 #include "eeprom.h"
@@ -68,10 +69,52 @@ STATIC_ASSERT((int64_t)(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (int64_t)(DYNAMIC_KEYM
 #    define DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE (DYNAMIC_KEYMAP_EEPROM_MAX_ADDR - DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + 1)
 #endif
 
+#define DYNAMIC_KEYMAP_KEYMAP_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#ifdef ENCODER_MAP_ENABLE
+#    define DYNAMIC_KEYMAP_ENCODER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * NUM_ENCODERS * 2 * 2)
+#else
+#    define DYNAMIC_KEYMAP_ENCODER_SIZE 0
+#endif
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// Stop the RAM mirror from taking up too much of the RAM on smaller MCUs
+#    ifndef DYNAMIC_KEYMAP_RAM_CACHE_MAX_SIZE
+#        if defined(__AVR__)
+#            define DYNAMIC_KEYMAP_RAM_CACHE_MAX_SIZE 512
+#        else
+#            define DYNAMIC_KEYMAP_RAM_CACHE_MAX_SIZE 8192
+#        endif
+#    endif
+
+STATIC_ASSERT(DYNAMIC_KEYMAP_KEYMAP_SIZE + DYNAMIC_KEYMAP_ENCODER_SIZE <= DYNAMIC_KEYMAP_RAM_CACHE_MAX_SIZE, "Dynamic keymaps are too large for DYNAMIC_KEYMAP_RAM_CACHE, reduce DYNAMIC_KEYMAP_LAYER_COUNT or raise DYNAMIC_KEYMAP_RAM_CACHE_MAX_SIZE.");
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// Write-through copy of the keymaps and encoder maps, same big endian layout as in EEPROM
+static uint8_t dynamic_keymap_cache[DYNAMIC_KEYMAP_KEYMAP_SIZE];
+#    ifdef ENCODER_MAP_ENABLE
+static uint8_t dynamic_keymap_encoder_cache[DYNAMIC_KEYMAP_ENCODER_SIZE];
+#    endif // ENCODER_MAP_ENABLE
+static bool dynamic_keymap_cache_loaded = false;
+
+static void dynamic_keymap_cache_load(void) {
+    if (dynamic_keymap_cache_loaded) return;
+    eeprom_read_block(dynamic_keymap_cache, (void *)DYNAMIC_KEYMAP_EEPROM_ADDR, sizeof(dynamic_keymap_cache));
+#    ifdef ENCODER_MAP_ENABLE
+    eeprom_read_block(dynamic_keymap_encoder_cache, (void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR, sizeof(dynamic_keymap_encoder_cache));
+#    endif // ENCODER_MAP_ENABLE
+    dynamic_keymap_cache_loaded = true;
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 void nvm_dynamic_keymap_erase(void) {
     // No-op, nvm_eeconfig_erase() will have already erased EEPROM if necessary.
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    // Reload from EEPROM on next access, in case it was erased underneath us.
+    dynamic_keymap_cache_loaded = false;
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 void nvm_dynamic_keymap_macro_erase(void) {
@@ -82,13 +125,25 @@ static inline void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t
     return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
 }
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+static inline uint8_t *dynamic_keymap_key_to_cache(uint8_t layer, uint8_t row, uint8_t column) {
+    return &dynamic_keymap_cache[(layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2)];
+}
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint16_t nvm_dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+    uint8_t *cached = dynamic_keymap_key_to_cache(layer, row, column);
+    return ((uint16_t)cached[0] << 8) | cached[1];
+#else
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
     keycode |= eeprom_read_byte(address + 1);
     return keycode;
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 void nvm_dynamic_keymap_update_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
@@ -97,6 +152,12 @@ void nvm_dynamic_keymap_update_keycode(uint8_t layer, uint8_t row, uint8_t colum
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+    uint8_t *cached = dynamic_keymap_key_to_cache(layer, row, column);
+    cached[0]       = (uint8_t)(keycode >> 8);
+    cached[1]       = (uint8_t)(keycode & 0xFF);
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -104,13 +165,25 @@ static void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t enc
     return ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2);
 }
 
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+static inline uint8_t *dynamic_keymap_encoder_to_cache(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+    return &dynamic_keymap_encoder_cache[(layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2) + (clockwise ? 0 : 2)];
+}
+#    endif // DYNAMIC_KEYMAP_RAM_CACHE
+
 uint16_t nvm_dynamic_keymap_read_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+    uint8_t *cached = dynamic_keymap_encoder_to_cache(layer, encoder_id, clockwise);
+    return ((uint16_t)cached[0] << 8) | cached[1];
+#    else
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
     keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
+#    endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 
 void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
@@ -119,35 +192,41 @@ void nvm_dynamic_keymap_update_encoder(uint8_t layer, uint8_t encoder_id, bool c
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+    uint8_t *cached = dynamic_keymap_encoder_to_cache(layer, encoder_id, clockwise);
+    cached[0]       = (uint8_t)(keycode >> 8);
+    cached[1]       = (uint8_t)(keycode & 0xFF);
+#    endif // DYNAMIC_KEYMAP_RAM_CACHE
 }
 #endif // ENCODER_MAP_ENABLE
 
-void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void    *source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint32_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+// Number of bytes of a buffer access that fall within a region, the rest is ignored or read as zero
+static uint32_t buffer_length_in_region(uint32_t offset, uint32_t size, uint32_t region_size) {
+    if (offset >= region_size) {
+        return 0;
     }
+    return size < region_size - offset ? size : region_size - offset;
+}
+
+void nvm_dynamic_keymap_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
+    uint32_t length = buffer_length_in_region(offset, size, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+    memcpy(data, &dynamic_keymap_cache[offset], length);
+#else
+    eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+    memset(data + length, 0x00, size - length);
 }
 
 void nvm_dynamic_keymap_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    uint32_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void    *target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
-    for (uint32_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    uint32_t length = buffer_length_in_region(offset, size, DYNAMIC_KEYMAP_KEYMAP_SIZE);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache_load();
+    memcpy(&dynamic_keymap_cache[offset], data, length);
+#endif // DYNAMIC_KEYMAP_RAM_CACHE
+    eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
 }
 
 uint32_t nvm_dynamic_keymap_macro_size(void) {
@@ -155,29 +234,14 @@ uint32_t nvm_dynamic_keymap_macro_size(void) {
 }
 
 void nvm_dynamic_keymap_macro_read_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void    *source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
-    }
+    uint32_t length = buffer_length_in_region(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
+    memset(data + length, 0x00, size - length);
 }
 
 void nvm_dynamic_keymap_macro_update_buffer(uint32_t offset, uint32_t size, uint8_t *data) {
-    void    *target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
-    }
+    uint32_t length = buffer_length_in_region(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
 }
 
 void nvm_dynamic_keymap_macro_reset(void) {
@@ -45,10 +45,146 @@
 #    include "connection.h"
 #endif
 
+#ifdef EECONFIG_WRITE_BACK
+#    include "keyboard.h"
+
+#    ifndef EECONFIG_WRITE_BACK_IDLE_TIME
+#        define EECONFIG_WRITE_BACK_IDLE_TIME 250
+#    endif
+
+// Largest write made at once, which never crosses a multiple of this size
+#    ifndef EECONFIG_WRITE_BACK_CHUNK_SIZE
+#        if defined(EXTERNAL_EEPROM_PAGE_SIZE)
+#            define EECONFIG_WRITE_BACK_CHUNK_SIZE EXTERNAL_EEPROM_PAGE_SIZE
+#        elif defined(__AVR__)
+#            define EECONFIG_WRITE_BACK_CHUNK_SIZE 1 // each byte takes a few ms to program
+#        else
+#            define EECONFIG_WRITE_BACK_CHUNK_SIZE 16
+#        endif
+#    endif
+
+// Copy of the whole eeconfig area, with the bytes not yet written back flagged as dirty
+static uint8_t write_back_buffer[EECONFIG_SIZE];
+static uint8_t write_back_dirty[(EECONFIG_SIZE + 7) / 8];
+static bool    write_back_loaded = false;
+
+static bool write_back_is_dirty(uint16_t offset) {
+    return write_back_dirty[offset / 8] & (1 << (offset % 8));
+}
+
+static void write_back_load(void) {
+    if (write_back_loaded) return;
+    eeprom_read_block(write_back_buffer, (void *)0, sizeof(write_back_buffer));
+    write_back_loaded = true;
+}
+
+// Dropped when eeconfig is erased, along with anything not written back yet
+static void write_back_discard(void) {
+    memset(write_back_dirty, 0, sizeof(write_back_dirty));
+    write_back_loaded = false;
+}
+
+static void write_back_read_block(void *buf, const void *addr, size_t len) {
+    write_back_load();
+    memcpy(buf, &write_back_buffer[(uintptr_t)addr], len);
+}
+
+static void write_back_update_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *data   = buf;
+    uint16_t       offset = (uintptr_t)addr;
+
+    write_back_load();
+    for (size_t i = 0; i < len; i++, offset++) {
+        if (write_back_buffer[offset] != data[i]) {
+            write_back_buffer[offset] = data[i];
+            write_back_dirty[offset / 8] |= 1 << (offset % 8);
+        }
+    }
+}
+
+static uint8_t write_back_read_byte(const uint8_t *addr) {
+    uint8_t value;
+    write_back_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+static uint16_t write_back_read_word(const uint16_t *addr) {
+    uint16_t value;
+    write_back_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+static uint32_t write_back_read_dword(const uint32_t *addr) {
+    uint32_t value;
+    write_back_read_block(&value, addr, sizeof(value));
+    return value;
+}
+
+static void write_back_update_byte(uint8_t *addr, uint8_t value) {
+    write_back_update_block(&value, addr, sizeof(value));
+}
+
+static void write_back_update_word(uint16_t *addr, uint16_t value) {
+    write_back_update_block(&value, addr, sizeof(value));
+}
+
+static void write_back_update_dword(uint32_t *addr, uint32_t value) {
+    write_back_update_block(&value, addr, sizeof(value));
+}
+
+/* Writes back the first dirty bytes, up to the end of their chunk. */
+static bool write_back_drain(void) {
+    uint16_t first = 0;
+    while (first < EECONFIG_SIZE && !write_back_is_dirty(first)) {
+        first++;
+    }
+    if (first == EECONFIG_SIZE) {
+        return false;
+    }
+
+    uint16_t end  = MIN((first / EECONFIG_WRITE_BACK_CHUNK_SIZE + 1) * EECONFIG_WRITE_BACK_CHUNK_SIZE, EECONFIG_SIZE);
+    uint16_t last = first;
+    for (uint16_t offset = first; offset < end; offset++) {
+        if (write_back_is_dirty(offset)) {
+            write_back_dirty[offset / 8] &= ~(1 << (offset % 8));
+            last = offset;
+        }
+    }
+
+    eeprom_update_block(&write_back_buffer[first], (void *)(uintptr_t)first, last - first + 1);
+    return true;
+}
+
+void nvm_eeconfig_flush(void) {
+    while (write_back_drain()) {
+    }
+}
+
+void nvm_eeconfig_task(void) {
+    // One chunk at a time, and only while nothing is being typed
+    if (last_input_activity_elapsed() >= EECONFIG_WRITE_BACK_IDLE_TIME) {
+        write_back_drain();
+    }
+}
+
+// Everything below goes through the write-back buffer
+#    define eeprom_read_byte write_back_read_byte
+#    define eeprom_read_word write_back_read_word
+#    define eeprom_read_dword write_back_read_dword
+#    define eeprom_read_block write_back_read_block
+#    define eeprom_update_byte write_back_update_byte
+#    define eeprom_update_word write_back_update_word
+#    define eeprom_update_dword write_back_update_dword
+#    define eeprom_update_block write_back_update_block
+#endif // EECONFIG_WRITE_BACK
+
 void nvm_eeconfig_erase(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_format(false);
 #endif // EEPROM_DRIVER
+#ifdef EECONFIG_WRITE_BACK
+    write_back_discard();
+#endif // EECONFIG_WRITE_BACK
 }
 
 bool nvm_eeconfig_is_enabled(void) {
@@ -67,6 +203,9 @@ void nvm_eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_format(false);
 #endif
+#ifdef EECONFIG_WRITE_BACK
+    write_back_discard();
+#endif // EECONFIG_WRITE_BACK
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
 
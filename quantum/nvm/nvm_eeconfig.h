@@ -13,6 +13,10 @@
 
 void nvm_eeconfig_erase(void);
 
+// Write back anything buffered, see EECONFIG_WRITE_BACK
+void nvm_eeconfig_flush(void);
+void nvm_eeconfig_task(void);
+
 bool nvm_eeconfig_is_enabled(void);
 bool nvm_eeconfig_is_disabled(void);
 
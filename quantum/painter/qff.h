@@ -41,6 +41,9 @@ STATIC_ASSERT(sizeof(qff_font_descriptor_v1_t) == (sizeof(qgf_block_header_v1_t)
 
 #define QFF_MAGIC 0x464651
 
+// QFF-specific font descriptor flags, in addition to QGF_FRAME_FLAG_TRANSPARENT
+#define QFF_FONT_FLAG_SORTED_UNICODE 0x80 // unicode glyph table is sorted by ascending code point
+
 /////////////////////////////////////////
 // ASCII glyph table descriptor
 
@@ -86,4 +89,4 @@ typedef struct PACKED qff_unicode_glyph_table_v1_t {
 
 bool     qff_validate_stream(qp_stream_t *stream);
 uint32_t qff_get_total_size(qp_stream_t *stream);
-bool     qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *has_ascii_table, uint16_t *num_unicode_glyphs, uint8_t *bpp, bool *has_palette, bool *is_panel_native, painter_compression_t *compression_scheme, uint32_t *total_bytes);
+bool     qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *has_ascii_table, uint16_t *num_unicode_glyphs, bool *unicode_table_sorted, uint8_t *bpp, bool *has_palette, bool *is_panel_native, painter_compression_t *compression_scheme, uint32_t *total_bytes);
@@ -111,25 +111,44 @@ bool qp_clear(painter_device_t device) {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_flush
 
-bool qp_flush(painter_device_t device) {
-    qp_dprintf("qp_flush: entry\n");
+bool qp_flush_async(painter_device_t device) {
+    qp_dprintf("qp_flush_async: entry\n");
     painter_driver_t *driver = (painter_driver_t *)device;
     if (!driver || !driver->validate_ok) {
-        qp_dprintf("qp_flush: fail (validation_ok == false)\n");
+        qp_dprintf("qp_flush_async: fail (validation_ok == false)\n");
         return false;
     }
 
     if (!qp_comms_start(device)) {
-        qp_dprintf("qp_flush: fail (could not start comms)\n");
+        qp_dprintf("qp_flush_async: fail (could not start comms)\n");
         return false;
     }
 
     bool ret = driver->driver_vtable->flush(device);
     qp_comms_stop(device);
+    qp_dprintf("qp_flush_async: %s\n", ret ? "ok" : "fail");
+    return ret;
+}
+
+bool qp_flush(painter_device_t device) {
+    qp_dprintf("qp_flush: entry\n");
+    bool ret = qp_flush_async(device);
+
+    // Wait for anything still being transmitted in the background
+    qp_comms_wait(device);
     qp_dprintf("qp_flush: %s\n", ret ? "ok" : "fail");
     return ret;
 }
 
+bool qp_is_busy(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        return false;
+    }
+
+    return qp_comms_busy(device);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_get_*
 
@@ -56,6 +56,15 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently-used unicode glyph lookups cached in RAM, per loaded font. Lookups of
+ *      glyphs outside the ASCII table otherwise need to search the font's unicode glyph table for every character
+ *      drawn. Each entry costs 8 bytes of RAM per font slot. Disabled by default.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +81,15 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_ASYNC_COMMS
+/**
+ * @def This controls whether pixel data is transmitted in the background, on comms drivers which support it. The pixel
+ *      data buffer is doubled, so that drawing can continue in one buffer while the other is being transmitted. This
+ *      requires another QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_ASYNC_COMMS FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -175,6 +193,29 @@ bool qp_clear(painter_device_t device);
  */
 bool qp_flush(painter_device_t device);
 
+/**
+ * Transmits any outstanding data to the screen, without waiting for background transmission to complete.
+ *
+ * @note Only differs from \ref qp_flush if QUANTUM_PAINTER_ASYNC_COMMS is enabled. Use \ref qp_is_busy to determine
+ *       when the transmission has completed.
+ *
+ * @param device[in] the handle of the device to control
+ * @return true if flushing changes to the screen was started
+ * @return false if flushing changes to the screen failed
+ */
+bool qp_flush_async(painter_device_t device);
+
+/**
+ * Checks whether a device still has pixel data being transmitted in the background.
+ *
+ * @note Always false unless QUANTUM_PAINTER_ASYNC_COMMS is enabled.
+ *
+ * @param device[in] the handle of the device to query
+ * @return true if a transmission is still in progress
+ * @return false if all drawing operations have been sent to the device
+ */
+bool qp_is_busy(painter_device_t device);
+
 /**
  * Retrieves the width of the display.
  *
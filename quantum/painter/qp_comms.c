@@ -1,7 +1,112 @@
 // Copyright 2021 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
+
 #include "qp_comms.h"
+#include "qp_draw.h"
+
+#if QUANTUM_PAINTER_ASYNC_COMMS
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Background transmission
+//
+// Pixel data sent from the global pixdata buffer is handed to the comms driver's comms_send_async, and drawing continues
+// in the other buffer. Only one transfer is ever in flight -- it's completed before the next one is started, before any
+// other comms operation, and before the comms driver is stopped. Stopping is deferred until then, so that the drawing
+// APIs can return while the last of their pixel data is still being transmitted.
+
+static struct {
+    painter_device_t device;       // device with a transfer in flight, or NULL
+    const uint8_t   *buffer;       // buffer being transmitted
+    bool             stop_pending; // qp_comms_stop() was called while the transfer was in flight
+} qp_comms_async_state = {0};
+
+// Completes the transfer in flight if the comms driver has finished with it, returning true if it's still in progress
+static bool qp_comms_async_poll(void) {
+    painter_device_t  device = qp_comms_async_state.device;
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!device) {
+        return false;
+    }
+
+    if (driver->comms_vtable->comms_busy(device)) {
+        return true;
+    }
+
+    bool stop                         = qp_comms_async_state.stop_pending;
+    qp_comms_async_state.device       = NULL;
+    qp_comms_async_state.buffer       = NULL;
+    qp_comms_async_state.stop_pending = false;
+    if (stop) {
+        driver->comms_vtable->comms_stop(device);
+    }
+    return false;
+}
+
+static void qp_comms_async_wait(void) {
+    while (qp_comms_async_poll()) {
+    }
+}
+
+static uint32_t qp_comms_async_send(painter_device_t device, uint32_t byte_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    uint8_t          *buffer = qp_internal_global_pixdata_buffer;
+    uint8_t          *next   = (buffer == qp_internal_pixdata_buffers[0]) ? qp_internal_pixdata_buffers[1] : qp_internal_pixdata_buffers[0];
+
+    // Both buffers are in use until the previous transfer completes
+    qp_comms_async_wait();
+
+    if (!driver->comms_vtable->comms_send_async(device, buffer, byte_count)) {
+        return driver->comms_vtable->comms_send(device, buffer, byte_count);
+    }
+
+    qp_comms_async_state.device = device;
+    qp_comms_async_state.buffer = buffer;
+
+    // Fills may be sent more than once, in chunks of any size, so drawing continues from a copy of what was sent along
+    // with the rest of the fill
+    memcpy(next, buffer, MAX(byte_count, qp_internal_global_pixdata_fill_bytes));
+    qp_internal_global_pixdata_buffer = next;
+    return byte_count;
+}
+
+void qp_comms_task(void) {
+    qp_comms_async_poll();
+}
+
+void qp_comms_release(void) {
+    qp_comms_async_wait();
+}
+
+// Called by spi_start(), so that other devices sharing the bus never find it still held by a deferred stop
+void spi_release_deferred(void) {
+    qp_comms_release();
+}
+
+bool qp_comms_busy(painter_device_t device) {
+    return qp_comms_async_poll() && qp_comms_async_state.device == device;
+}
+
+void qp_comms_wait(painter_device_t device) {
+    if (qp_comms_async_state.device == device) {
+        qp_comms_async_wait();
+    }
+}
+
+#else // QUANTUM_PAINTER_ASYNC_COMMS
+
+void qp_comms_task(void) {}
+
+void qp_comms_release(void) {}
+
+bool qp_comms_busy(painter_device_t device) {
+    return false;
+}
+
+void qp_comms_wait(painter_device_t device) {}
+
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base comms APIs
@@ -13,6 +118,10 @@ bool qp_comms_init(painter_device_t device) {
         return false;
     }
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    qp_comms_async_wait();
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
     return driver->comms_vtable->comms_init(device);
 }
 
@@ -23,6 +132,17 @@ bool qp_comms_start(painter_device_t device) {
         return false;
     }
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    if (qp_comms_async_state.device == device && qp_comms_async_state.stop_pending) {
+        // Still started, as the previous operation's stop has been deferred -- carry on without stopping in between
+        qp_comms_async_state.stop_pending = false;
+        return true;
+    }
+
+    // Another device may still hold the bus
+    qp_comms_async_wait();
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
     return driver->comms_vtable->comms_start(device);
 }
 
@@ -33,6 +153,17 @@ void qp_comms_stop(painter_device_t device) {
         return;
     }
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    // Nothing resends a fill after the operation that made it
+    qp_internal_global_pixdata_fill_bytes = 0;
+
+    if (qp_comms_async_state.device == device) {
+        // Stopped by qp_comms_async_poll() once the transfer completes
+        qp_comms_async_state.stop_pending = true;
+        return;
+    }
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
     driver->comms_vtable->comms_stop(device);
 }
 
@@ -43,6 +174,16 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    if (driver->comms_vtable->comms_send_async) {
+        // Only the global pixdata buffer can be swapped out while it's in flight, anything else is sent synchronously
+        if (data == qp_internal_global_pixdata_buffer && byte_count <= QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) {
+            return qp_comms_async_send(device, byte_count);
+        }
+        qp_comms_async_wait();
+    }
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
@@ -52,6 +193,9 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
 bool qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t                    *driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    qp_comms_async_wait(); // commands must not be interleaved with pixel data
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
     return comms_vtable->send_command(device, cmd);
 }
 
@@ -68,5 +212,8 @@ uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const vo
 bool qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
     painter_driver_t                    *driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    qp_comms_async_wait();
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
     return comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
@@ -16,6 +16,17 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Background transmission APIs, only effective with QUANTUM_PAINTER_ASYNC_COMMS
+
+bool qp_comms_busy(painter_device_t device);
+void qp_comms_wait(painter_device_t device);
+void qp_comms_task(void);
+void qp_comms_release(void); // completes any transfer in flight, along with its deferred stop
+
+// Implements the spi_master.h hook with qp_comms_release(), so that spi_start() for other devices on the bus releases it
+void spi_release_deferred(void);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -9,8 +9,18 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter utility functions
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+// Global variable used for native pixel data streaming, pointing at whichever of the double buffers is not in flight.
+// Sending it may swap it for the other buffer, so it must be re-read after each transmission rather than cached.
+extern uint8_t  qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+extern uint8_t *qp_internal_global_pixdata_buffer;
+
+// Number of leading bytes of the buffer written by qp_internal_fill_pixdata(), which callers may send more than once
+extern uint32_t qp_internal_global_pixdata_fill_bytes;
+#else
 // Global variable used for native pixel data streaming.
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
@@ -20,8 +20,16 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //       **** very likely get artifacts rendered to the screen as a result.                                       ****
 //
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+// Buffers used for transmitting native pixel data to the downstream device. Drawing happens in the one pointed to by
+// qp_internal_global_pixdata_buffer, which is swapped for the other when handed to the comms driver -- see qp_comms.c.
+__attribute__((__aligned__(4))) uint8_t qp_internal_pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+uint8_t                                *qp_internal_global_pixdata_buffer     = qp_internal_pixdata_buffers[0];
+uint32_t                                qp_internal_global_pixdata_fill_bytes = 0;
+#else
 // Buffer used for transmitting native pixel data to the downstream device.
 __attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
@@ -63,6 +71,10 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     for (uint32_t i = 0; i < num_pixels; ++i) {
         driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
     }
+
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    qp_internal_global_pixdata_fill_bytes = (num_pixels * driver->native_bits_per_pixel + 7) / 8;
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
 }
 
 // Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
@@ -12,11 +12,21 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point;
+    uint32_t value; // Uses QFF_GLYPH_*_(BITS|MASK), same as the glyph tables
+} qff_glyph_cache_entry_t;
+
+#    define QFF_GLYPH_CACHE_EMPTY UINT32_MAX
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
     bool                  has_ascii_table;
     uint16_t              num_unicode_glyphs;
+    bool                  unicode_table_sorted;
     uint8_t               bpp;
     bool                  has_palette;
     bool                  is_panel_native;
@@ -32,6 +42,10 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE];
+    uint8_t                 glyph_cache_next;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
@@ -98,7 +112,7 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
     // Read the info (parsing already successful above, no need to check return value)
-    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->bpp, &font->has_palette, &font->is_panel_native, &font->compression_scheme, NULL);
+    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->unicode_table_sorted, &font->bpp, &font->has_palette, &font->is_panel_native, &font->compression_scheme, NULL);
 
     if (!qp_internal_bpp_capable(font->bpp)) {
         qp_dprintf("qp_load_font: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)font->bpp);
@@ -106,6 +120,14 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
         return NULL;
     }
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    // Forget any glyphs cached from a font previously loaded into this slot
+    for (int i = 0; i < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE; ++i) {
+        font->glyph_cache[i].code_point = QFF_GLYPH_CACHE_EMPTY;
+    }
+    font->glyph_cache_next = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
     // Validation success, we can return the handle
     font->validate_ok = true;
     qp_dprintf("qp_load_font: ok\n");
@@ -214,6 +236,83 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
+// Helper that moves the stream to the start of a glyph's image data, given its glyph table value
+static inline bool qp_drawtext_seek_glyph_data(qff_font_handle_t *qff_font, uint32_t glyph_value, uint8_t *width) {
+    uint8_t  glyph_width  = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    uint32_t glyph_offset = ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+                           + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+                           + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                           + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+                           + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
+                           + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
+
+    if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    *width = glyph_width;
+    return true;
+}
+
+// Helper that looks up a code point in the unicode glyph table, returning its glyph table value
+static inline bool qp_drawtext_find_unicode_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint32_t *glyph_value) {
+    uint32_t glyph_table_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
+                                  + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                                  + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+
+    qff_unicode_glyph_v1_t glyph_info;
+    if (qff_font->unicode_table_sorted) {
+        // Table is ordered by code point, so binary search it
+        uint16_t lower = 0;
+        uint16_t upper = qff_font->num_unicode_glyphs;
+        while (lower < upper) {
+            uint16_t middle = lower + (upper - lower) / 2;
+            if (qp_stream_setpos(&qff_font->stream, glyph_table_offset + middle * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while searching unicode glyph info\n");
+                return false;
+            }
+
+            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                qp_dprintf("Failed to read unicode glyph info\n");
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                *glyph_value = glyph_info.value;
+                return true;
+            } else if (glyph_info.code_point < code_point) {
+                lower = middle + 1;
+            } else {
+                upper = middle;
+            }
+        }
+    } else {
+        // No ordering guarantee, check each entry in turn
+        if (qp_stream_setpos(&qff_font->stream, glyph_table_offset) < 0) {
+            qp_dprintf("Failed to set stream position while preparing glyph data\n");
+            return false;
+        }
+
+        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                *glyph_value = glyph_info.value;
+                return true;
+            }
+        }
+    }
+
+    // Not found
+    qp_dprintf("Failed to find unicode glyph info\n");
+    return false;
+}
+
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
@@ -231,63 +330,32 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
-        }
-
-        *width = glyph_width;
-        return true;
+        return qp_drawtext_seek_glyph_data(qff_font, glyph_info.value, width);
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
-        }
+        uint32_t glyph_value;
 
-        qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
-                return false;
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        // Check the recently-used glyphs first
+        for (int i = 0; i < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE; ++i) {
+            if (qff_font->glyph_cache[i].code_point == code_point) {
+                return qp_drawtext_seek_glyph_data(qff_font, qff_font->glyph_cache[i].value, width);
             }
+        }
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
 
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
-            }
+        if (!qp_drawtext_find_unicode_glyph(qff_font, code_point, &glyph_value)) {
+            return false;
         }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
-        return false;
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        // Replace the oldest cache entry
+        qff_font->glyph_cache[qff_font->glyph_cache_next].code_point = code_point;
+        qff_font->glyph_cache[qff_font->glyph_cache_next].value      = glyph_value;
+        qff_font->glyph_cache_next                                   = (qff_font->glyph_cache_next + 1) % QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+        return qp_drawtext_seek_glyph_data(qff_font, glyph_value, width);
     }
     return false;
 }
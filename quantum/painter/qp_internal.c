@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_internal.h"
+#include "qp_comms.h"
 
 #include "compiler_support.h"
 
@@ -72,6 +73,11 @@ static void qp_internal_display_timeout_task(void) {
 STATIC_ASSERT((QUANTUM_PAINTER_TASK_THROTTLE) > 0 && (QUANTUM_PAINTER_TASK_THROTTLE) < 1000, "QUANTUM_PAINTER_TASK_THROTTLE must be between 1 and 999");
 
 void qp_internal_task(void) {
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    // Complete any background transmission as soon as it's done, so the bus is released for other devices
+    qp_comms_task();
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
     // Perform throttling of the internal processing of Quantum Painter
     static uint32_t last_tick = 0;
     uint32_t        now       = timer_read32();
@@ -38,12 +38,19 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_send_async_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_busy_func)(painter_device_t device);
 
 typedef struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+
+    // Optional, used when QUANTUM_PAINTER_ASYNC_COMMS is enabled -- starts a transfer which completes in the background,
+    // and reports whether it is still in progress. Left NULL, all transfers are sent using comms_send.
+    painter_driver_comms_send_async_func comms_send_async;
+    painter_driver_comms_busy_func       comms_busy;
 } painter_comms_vtable_t;
 
 typedef bool (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
@@ -33,6 +33,18 @@
 #    error More than one rotation selected.  This is not supported.
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+#    ifndef POINTING_DEVICE_MOTION_PIN
+#        error "POINTING_DEVICE_MOTION_INTERRUPT requires POINTING_DEVICE_MOTION_PIN to be defined"
+#    endif
+#    ifdef PROTOCOL_CHIBIOS
+#        include <hal.h>
+#        if !PAL_USE_CALLBACKS
+#            error "POINTING_DEVICE_MOTION_INTERRUPT requires PAL_USE_CALLBACKS to be enabled in halconf.h"
+#        endif
+#    endif
+#endif
+
 #if defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT) || defined(POINTING_DEVICE_COMBINED)
 #    ifndef SPLIT_POINTING_ENABLE
 #        error "Using POINTING_DEVICE_LEFT or POINTING_DEVICE_RIGHT or POINTING_DEVICE_COMBINED, then SPLIT_POINTING_ENABLE is required but has not been defined"
@@ -88,6 +100,14 @@ static pointing_device_status_t pointing_device_status     = POINTING_DEVICE_STA
 static uint16_t hires_scroll_resolution;
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+static volatile bool motion_pending = false;
+static int32_t       motion_x       = 0;
+static int32_t       motion_y       = 0;
+static int32_t       motion_h       = 0;
+static int32_t       motion_v       = 0;
+#endif
+
 #define POINTING_DEVICE_DRIVER_CONCAT(name) name##_pointing_device_driver
 #define POINTING_DEVICE_DRIVER(name) POINTING_DEVICE_DRIVER_CONCAT(name)
 
@@ -173,6 +193,59 @@ __attribute__((weak)) uint8_t pointing_device_handle_buttons(uint8_t buttons, bo
     return buttons;
 }
 
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+/**
+ * @brief Flags that the sensor has motion data waiting
+ *
+ * Called from the motion pin interrupt, so only latches the event; the sensor is read by the next pointing_device_task.
+ * Boards with their own interrupt handling may call this directly.
+ */
+void pointing_device_motion_interrupt(void) {
+    motion_pending = true;
+}
+
+#    ifdef PROTOCOL_CHIBIOS
+static void pointing_device_motion_callback(void *arg) {
+    (void)arg;
+    pointing_device_motion_interrupt();
+}
+#    endif
+
+/**
+ * @brief Reads the sensor if it has signalled motion, adding the movement to the accumulated totals
+ */
+static void pointing_device_motion_accumulate(void) {
+#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    bool pin_active = !gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#    else
+    bool pin_active = gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#    endif
+    if (!motion_pending && !pin_active) {
+        return;
+    }
+    // Cleared before reading, so an edge during the read is picked up next time around
+    motion_pending = false;
+
+    report_mouse_t report      = {.buttons = local_mouse_report.buttons};
+    report                     = pointing_device_driver->get_report(report);
+    local_mouse_report.buttons = report.buttons;
+
+    motion_x += report.x;
+    motion_y += report.y;
+    motion_h += report.h;
+    motion_v += report.v;
+}
+
+/**
+ * @brief Takes as much of the accumulated movement as fits in a report, leaving the remainder for the next one
+ */
+static int32_t pointing_device_motion_take(int32_t *total, int32_t min, int32_t max) {
+    int32_t amount = *total < min ? min : (*total > max ? max : *total);
+    *total -= amount;
+    return amount;
+}
+#endif
+
 /**
  * @brief Initialises pointing device
  *
@@ -194,6 +267,14 @@ __attribute__((weak)) void pointing_device_init(void) {
 #    else
         gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN);
 #    endif
+#endif
+#if defined(POINTING_DEVICE_MOTION_INTERRUPT) && defined(PROTOCOL_CHIBIOS)
+#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+        palEnableLineEvent(POINTING_DEVICE_MOTION_PIN, PAL_EVENT_MODE_FALLING_EDGE);
+#    else
+        palEnableLineEvent(POINTING_DEVICE_MOTION_PIN, PAL_EVENT_MODE_RISING_EDGE);
+#    endif
+        palSetLineCallback(POINTING_DEVICE_MOTION_PIN, pointing_device_motion_callback, NULL);
 #endif
     }
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
@@ -294,6 +375,9 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
  * This function is part of the keyboard loop and retrieves the mouse report from the pointing device driver.
  * It applies any optional configuration e.g. rotation or axis inversion and then initiates a send.
  *
+ * With POINTING_DEVICE_MOTION_INTERRUPT, the sensor is read on every loop that it has motion, and the movement
+ * accumulated since the last report is sent as one report per POINTING_DEVICE_TASK_THROTTLE_MS.
+ *
  */
 __attribute__((weak)) bool pointing_device_task(void) {
 #if defined(SPLIT_POINTING_ENABLE)
@@ -303,6 +387,12 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+    if (pointing_device_get_status() == POINTING_DEVICE_STATUS_SUCCESS) {
+        pointing_device_motion_accumulate();
+    }
+#endif
+
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
@@ -320,32 +410,41 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #    if defined(SPLIT_POINTING_ENABLE)
 #        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
 #    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+#endif
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+    local_mouse_report.x = pointing_device_motion_take(&motion_x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    local_mouse_report.y = pointing_device_motion_take(&motion_y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    local_mouse_report.h = pointing_device_motion_take(&motion_h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    local_mouse_report.v = pointing_device_motion_take(&motion_v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+#else
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
     if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
+#        else
     if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
+#        endif
     {
-#endif
+#    endif
 
-#if defined(SPLIT_POINTING_ENABLE)
-#    if defined(POINTING_DEVICE_COMBINED)
+#    if defined(SPLIT_POINTING_ENABLE)
+#        if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
         local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
-#    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
+#        elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
         local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+#        else
+#            error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
+#        endif
 #    else
-#        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
-#    endif
-#else
     local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
+#    endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#    ifdef POINTING_DEVICE_MOTION_PIN
     }
-#endif
+#    endif
+#endif // defined(POINTING_DEVICE_MOTION_INTERRUPT)
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -140,6 +140,13 @@ void           pointing_device_keycode_handler(uint16_t keycode, bool pressed);
 uint16_t pointing_device_get_hires_scroll_resolution(void);
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+void pointing_device_motion_interrupt(void);
+#    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
+#        define POINTING_DEVICE_TASK_THROTTLE_MS 1
+#    endif
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 void     pointing_device_set_shared_report(report_mouse_t report);
 uint16_t pointing_device_get_shared_cpi(void);
@@ -22,6 +22,14 @@
 static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
 static uint8_t typo_buffer_size                    = 1;
 
+#ifdef AUTOCORRECT_DATA_AUTOMATON
+// Automaton state after feeding it the first `automaton_size` keycodes of the
+// typo buffer. Recomputed from the buffer whenever the two get out of sync,
+// e.g. on backspace or when the buffer gets cleared.
+static uint16_t automaton_state = 0;
+static uint8_t  automaton_size  = 0;
+#endif
+
 /**
  * @brief function for querying the enabled state of autocorrect
  *
@@ -189,6 +197,126 @@ __attribute__((weak)) bool apply_autocorrect(uint8_t backspaces, const char *str
     return true;
 }
 
+/**
+ * @brief Applies the correction stored in a leaf node of `autocorrect_data`
+ *
+ * @param state byte offset of the leaf node
+ * @param keycode Keycode that completed the typo
+ * @param record keyrecord_t structure
+ * @return true Continue processing keycodes, and send to host
+ * @return false Stop processing keycodes, and don't send to host
+ */
+static bool autocorrect_apply_typo(uint16_t state, uint16_t keycode, keyrecord_t *record) {
+    const uint8_t backspaces = (pgm_read_byte(autocorrect_data + state) & 63) + !record->event.pressed;
+    const char   *changes    = (const char *)(autocorrect_data + state + 1);
+
+    /* Gather info about the typo'd word
+     *
+     * Since buffer may contain several words, delimited by spaces, we
+     * iterate from the end to find the start and length of the typo
+     */
+    char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
+
+    uint8_t typo_len   = 0;
+    uint8_t typo_start = 0;
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    for (uint8_t i = typo_buffer_size; i > 0; --i) {
+        // stop counting after finding space (unless it is the last thing)
+        if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
+            typo_start = i;
+            break;
+        }
+
+        ++typo_len;
+    }
+
+    // when detecting 'typo:', reduce the length of the string by one
+    if (space_last) {
+        --typo_len;
+    }
+
+    // convert buffer of keycodes into a string
+    for (uint8_t i = 0; i < typo_len; ++i) {
+        typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
+    }
+
+    /* Gather the corrected word
+     *
+     * A) Correction of 'typo:' -- Code takes into account
+     * an extra backspace to delete the space (which we dont copy)
+     * for this reason the offset is correct to "skip" the null terminator
+     *
+     * B) When correcting 'typo' -- Need extra offset for terminator
+     */
+    char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
+
+    uint8_t offset = space_last ? backspaces : backspaces + 1;
+    strcpy(correct, typo);
+    strcpy_P(correct + typo_len - offset, changes);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; ++i) {
+            tap_code(KC_BSPC);
+        }
+        send_string_P(changes);
+    }
+
+    if (keycode == KC_SPC) {
+        typo_buffer[0]   = KC_SPC;
+        typo_buffer_size = 1;
+        return true;
+    } else {
+        typo_buffer_size = 0;
+        return false;
+    }
+}
+
+#ifdef AUTOCORRECT_DATA_AUTOMATON
+static uint16_t autocorrect_read_link(uint16_t offset) {
+    return pgm_read_byte(autocorrect_data + offset) | pgm_read_byte(autocorrect_data + offset + 1) << 8;
+}
+
+/**
+ * @brief Advances the autocorrect automaton by one keycode
+ *
+ * Follows failure links until a node with a matching child is found, or the
+ * root is reached. Each failure link moves to a shorter suffix of the input,
+ * so this is amortized constant time per keycode.
+ *
+ * @param state byte offset of the current node
+ * @param keycode keycode to advance with
+ * @return uint16_t byte offset of the new node
+ */
+static uint16_t autocorrect_automaton_step(uint16_t state, uint8_t keycode) {
+    while (state < DICTIONARY_SIZE) {
+        uint8_t code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) {
+            // Leaf nodes have no children, typos end there.
+            return 0;
+        } else if (code & 64) { // Chain node, the only child follows it.
+            if ((code & 63) == keycode) {
+                return state + 3;
+            }
+        } else { // Branching node with `code` children.
+            for (uint16_t branch = state + 3; code > 0; --code, branch += 3) {
+                if (pgm_read_byte(autocorrect_data + branch) == keycode) {
+                    return autocorrect_read_link(branch + 1);
+                }
+            }
+        }
+
+        if (state == 0) {
+            return 0;
+        }
+        // Follow the failure link to the longest suffix that is in the automaton.
+        state = autocorrect_read_link(state + 1);
+    }
+    // Invalid index, should not normally happen.
+    return 0;
+}
+#endif
+
 /**
  * @brief Process handler for autocorrect feature
  *
@@ -270,10 +398,37 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
     if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
         memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
         typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+#ifdef AUTOCORRECT_DATA_AUTOMATON
+        // The state never spans the whole buffer, as that would be a typo of
+        // maximum length, which is corrected and resets the buffer.
+        if (automaton_size == AUTOCORRECT_MAX_LENGTH) {
+            automaton_size = AUTOCORRECT_MAX_LENGTH - 1;
+        }
+#endif
+    }
+
+#ifdef AUTOCORRECT_DATA_AUTOMATON
+    // Resynchronize the automaton if the buffer was edited.
+    if (automaton_size != typo_buffer_size) {
+        automaton_state = 0;
+        for (automaton_size = 0; automaton_size < typo_buffer_size; ++automaton_size) {
+            automaton_state = autocorrect_automaton_step(automaton_state, typo_buffer[automaton_size]);
+        }
     }
+#endif
 
     // Append `keycode` to buffer.
     typo_buffer[typo_buffer_size++] = keycode;
+
+#ifdef AUTOCORRECT_DATA_AUTOMATON
+    // Check for typo in buffer using the automaton stored in `autocorrect_data`.
+    automaton_state = autocorrect_automaton_step(automaton_state, keycode);
+    automaton_size  = typo_buffer_size;
+
+    if (pgm_read_byte(autocorrect_data + automaton_state) & 128) { // A typo was found! Apply autocorrect.
+        return autocorrect_apply_typo(automaton_state, keycode, record);
+    }
+#else
     // Return if buffer is smaller than the shortest word.
     if (typo_buffer_size < AUTOCORRECT_MIN_LENGTH) {
         return true;
@@ -308,69 +463,9 @@ bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
         code = pgm_read_byte(autocorrect_data + state);
 
         if (code & 128) { // A typo was found! Apply autocorrect.
-            const uint8_t backspaces = (code & 63) + !record->event.pressed;
-            const char   *changes    = (const char *)(autocorrect_data + state + 1);
-
-            /* Gather info about the typo'd word
-             *
-             * Since buffer may contain several words, delimited by spaces, we
-             * iterate from the end to find the start and length of the typo
-             */
-            char typo[AUTOCORRECT_MAX_LENGTH + 1] = {0}; // extra char for null terminator
-
-            uint8_t typo_len   = 0;
-            uint8_t typo_start = 0;
-            bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
-            for (uint8_t i = typo_buffer_size; i > 0; --i) {
-                // stop counting after finding space (unless it is the last thing)
-                if (typo_buffer[i - 1] == KC_SPC && i != typo_buffer_size) {
-                    typo_start = i;
-                    break;
-                }
-
-                ++typo_len;
-            }
-
-            // when detecting 'typo:', reduce the length of the string by one
-            if (space_last) {
-                --typo_len;
-            }
-
-            // convert buffer of keycodes into a string
-            for (uint8_t i = 0; i < typo_len; ++i) {
-                typo[i] = typo_buffer[typo_start + i] - KC_A + 'a';
-            }
-
-            /* Gather the corrected word
-             *
-             * A) Correction of 'typo:' -- Code takes into account
-             * an extra backspace to delete the space (which we dont copy)
-             * for this reason the offset is correct to "skip" the null terminator
-             *
-             * B) When correcting 'typo' -- Need extra offset for terminator
-             */
-            char correct[AUTOCORRECT_MAX_LENGTH + 10] = {0}; // let's hope this is big enough
-
-            uint8_t offset = space_last ? backspaces : backspaces + 1;
-            strcpy(correct, typo);
-            strcpy_P(correct + typo_len - offset, changes);
-
-            if (apply_autocorrect(backspaces, changes, typo, correct)) {
-                for (uint8_t i = 0; i < backspaces; ++i) {
-                    tap_code(KC_BSPC);
-                }
-                send_string_P(changes);
-            }
-
-            if (keycode == KC_SPC) {
-                typo_buffer[0]   = KC_SPC;
-                typo_buffer_size = 1;
-                return true;
-            } else {
-                typo_buffer_size = 0;
-                return false;
-            }
+            return autocorrect_apply_typo(state, keycode, record);
         }
     }
+#endif
     return true;
 }
@@ -16,6 +16,7 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#include <string.h>
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -102,6 +103,26 @@ static queued_combo_t combo_buffer[COMBO_BUFFER_LENGTH];
 
 #define INCREMENT_MOD(i) i = (i + 1) % COMBO_BUFFER_LENGTH
 
+#ifdef COMBO_INDEX_LENGTH
+/* Lookup table of (keycode, combo index) pairs, sorted by keycode and then
+ * by combo index, so that only the combos containing a given keycode need to
+ * be processed for a key event. Built lazily from the combo definitions. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_lookup_entry_t;
+
+typedef enum { COMBO_LOOKUP_STALE, COMBO_LOOKUP_VALID, COMBO_LOOKUP_OVERFLOW } combo_lookup_state_t;
+
+static combo_lookup_entry_t combo_lookup[COMBO_INDEX_LENGTH];
+static uint16_t             combo_lookup_size  = 0;
+static uint16_t             combo_lookup_count = 0;
+static combo_lookup_state_t combo_lookup_state = COMBO_LOOKUP_STALE;
+/* Set whenever a combo's state may have been touched, so that clear_combos()
+ * doesn't have to walk every combo when nothing has happened. */
+static bool combo_states_dirty = false;
+#endif
+
 #ifndef EXTRA_SHORT_COMBOS
 /* flags are their own elements in combo_t struct. */
 #    define COMBO_ACTIVE(combo) (combo->active)
@@ -202,11 +223,23 @@ static inline uint16_t _get_combo_term(uint16_t combo_index, combo_t *combo) {
 void clear_combos(void) {
     uint16_t index = 0;
     longest_term   = 0;
+#ifdef COMBO_INDEX_LENGTH
+    if (!combo_states_dirty) {
+        return;
+    }
+    combo_states_dirty = false;
+#endif
     for (index = 0; index < combo_count(); ++index) {
         combo_t *combo = combo_get(index);
         if (!COMBO_ACTIVE(combo)) {
             RESET_COMBO_STATE(combo);
         }
+#ifdef COMBO_INDEX_LENGTH
+        else {
+            // active combos are reset on a later call, after release
+            combo_states_dirty = true;
+        }
+#endif
     }
 }
 
@@ -264,7 +297,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -436,6 +468,10 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
         return COMBO_KEY_NOT_PRESSED;
     }
 
+#ifdef COMBO_INDEX_LENGTH
+    combo_states_dirty = true;
+#endif
+
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -555,9 +591,61 @@ static combo_key_action_t process_single_combo(combo_t *combo, uint16_t keycode,
     return key_is_part_of_combo ? COMBO_KEY_PRESSED : COMBO_KEY_NOT_PRESSED;
 }
 
+#ifdef COMBO_INDEX_LENGTH
+static void build_combo_lookup(void) {
+    combo_lookup_size  = 0;
+    combo_lookup_count = combo_count();
+    combo_lookup_state = COMBO_LOOKUP_VALID;
+
+    for (uint16_t idx = 0; idx < combo_lookup_count; ++idx) {
+        combo_t *combo = combo_get(idx);
+        uint16_t key;
+
+        for (uint8_t key_i = 0; (key = pgm_read_word(&combo->keys[key_i])) != COMBO_END; ++key_i) {
+            if (combo_lookup_size >= COMBO_INDEX_LENGTH) {
+                // too many combo keys, fall back to scanning every combo
+                combo_lookup_state = COMBO_LOOKUP_OVERFLOW;
+                return;
+            }
+
+            // insertion sort; combo indices are visited in ascending order,
+            // so entries sharing a keycode stay ordered by combo index.
+            uint16_t pos = combo_lookup_size;
+            while (pos > 0 && combo_lookup[pos - 1].keycode > key) {
+                pos--;
+            }
+            if (pos > 0 && combo_lookup[pos - 1].keycode == key && combo_lookup[pos - 1].combo_index == idx) {
+                // key listed twice in the same combo
+                continue;
+            }
+            memmove(&combo_lookup[pos + 1], &combo_lookup[pos], (combo_lookup_size - pos) * sizeof(combo_lookup_entry_t));
+            combo_lookup[pos] = (combo_lookup_entry_t){
+                .keycode     = key,
+                .combo_index = idx,
+            };
+            combo_lookup_size++;
+        }
+    }
+}
+
+/* Returns the position of the first lookup entry for the keycode, or
+ * combo_lookup_size if no combo contains it. */
+static uint16_t combo_lookup_find(uint16_t keycode) {
+    uint16_t low = 0, high = combo_lookup_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_lookup[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    uint8_t is_combo_key          = COMBO_KEY_NOT_PRESSED;
-    bool    no_combo_keys_pressed = true;
+    uint8_t is_combo_key = COMBO_KEY_NOT_PRESSED;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -585,10 +673,24 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_INDEX_LENGTH
+    if (combo_lookup_state == COMBO_LOOKUP_STALE || combo_lookup_count != combo_count()) {
+        build_combo_lookup();
+    }
+
+    // COMBO_END matches the terminator of every combo, so leave it to the full scan
+    if (combo_lookup_state == COMBO_LOOKUP_VALID && keycode != COMBO_END) {
+        for (uint16_t i = combo_lookup_find(keycode); i < combo_lookup_size && combo_lookup[i].keycode == keycode; ++i) {
+            uint16_t idx = combo_lookup[i].combo_index;
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -676,3 +778,9 @@ void combo_toggle(void) {
 bool is_combo_enabled(void) {
     return b_combo_enable;
 }
+
+void combo_index_invalidate(void) {
+#ifdef COMBO_INDEX_LENGTH
+    combo_lookup_state = COMBO_LOOKUP_STALE;
+#endif
+}
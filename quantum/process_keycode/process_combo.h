@@ -79,3 +79,4 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+void combo_index_invalidate(void);
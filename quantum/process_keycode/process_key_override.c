@@ -85,6 +85,21 @@ static uint16_t deferred_register = 0;
 // TODO: in future maybe save in EEPROM?
 static bool enabled = true;
 
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+// Lookup table of (trigger, override index) pairs, sorted by trigger and then by override index, so that only the overrides that a key event could activate need to be checked. Built lazily from the key override definitions.
+typedef struct {
+    uint16_t trigger;
+    uint16_t override_index;
+} key_override_lookup_entry_t;
+
+typedef enum { KEY_OVERRIDE_LOOKUP_STALE, KEY_OVERRIDE_LOOKUP_VALID, KEY_OVERRIDE_LOOKUP_OVERFLOW } key_override_lookup_state_t;
+
+static key_override_lookup_entry_t key_override_lookup[KEY_OVERRIDE_INDEX_LENGTH];
+static uint16_t                    key_override_lookup_size  = 0;
+static uint16_t                    key_override_lookup_count = 0;
+static key_override_lookup_state_t key_override_lookup_state = KEY_OVERRIDE_LOOKUP_STALE;
+#endif
+
 // Forward decls
 static const key_override_t *clear_active_override(const bool allow_reregister);
 
@@ -111,6 +126,12 @@ bool key_override_is_enabled(void) {
     return enabled;
 }
 
+void key_override_index_invalidate(void) {
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+    key_override_lookup_state = KEY_OVERRIDE_LOOKUP_STALE;
+#endif
+}
+
 // Returns whether the modifiers that are pressed are such that the override should activate
 static bool key_override_matches_active_modifiers(const key_override_t *override, const uint8_t mods) {
     // Check that negative keys pass
@@ -244,147 +265,250 @@ static bool check_activation_event(const key_override_t *override, const bool ke
     }
 }
 
-/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
-static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
-    if (key_override_count() == 0) {
-        return true;
+/** Tries activating the provided override. Returns true if it was activated, in which case `send_key_action` is set to whether the key action for `keycode` should be sent */
+static bool try_activating_single_override(const key_override_t *const override, const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *send_key_action) {
+    // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
+    if (active_mods == 0 && override->trigger_mods != 0) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
     }
 
-    for (uint8_t i = 0; i < key_override_count(); i++) {
-        const key_override_t *const override = key_override_get(i);
+    // Check layer
+    if ((override->layers & (1 << layer)) == 0) {
+        key_override_printf("Not activating override: Not set to activate on pressed layer\n");
+        return false;
+    }
 
-        // End of array
-        if (override == NULL) {
-            break;
-        }
+    // Check allowed activation events
+    if (!check_activation_event(override, key_down, is_mod)) {
+        key_override_printf("Not activating override: Activation event not allowed\n");
+        return false;
+    }
 
-        // Fast, but not full mods check. Most key presses will not have any mods down, and most overrides will require mods. Hence here we filter overrides that require mods to be down while no mods are down
-        if (active_mods == 0 && override->trigger_mods != 0) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    const bool is_trigger = override->trigger == keycode;
 
-        // Check layer
-        if ((override->layers & (1 << layer)) == 0) {
-            key_override_printf("Not activating override: Not set to activate on pressed layer\n");
-            continue;
-        }
+    // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
+    if (is_trigger && !key_down) {
+        key_override_printf("Not activating override: Trigger lifted\n");
+        return false;
+    }
 
-        // Check allowed activation events
-        if (!check_activation_event(override, key_down, is_mod)) {
-            key_override_printf("Not activating override: Activation event not allowed\n");
-            continue;
-        }
+    // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
+    const bool no_trigger = override->trigger == KC_NO;
 
-        const bool is_trigger = override->trigger == keycode;
+    // Check if aleady active
+    if (override == active_override) {
+        key_override_printf("Not activating override: Alerady actived\n");
+        return false;
+    }
 
-        // Check if trigger lifted. This is a small optimization in order to skip the remaining checks
-        if (is_trigger && !key_down) {
-            key_override_printf("Not activating override: Trigger lifted\n");
-            continue;
-        }
+    // Check if enabled
+    if (override->enabled != NULL && !((*(override->enabled) & 1))) {
+        key_override_printf("Not activating override: Not enabled\n");
+        return false;
+    }
 
-        // If the trigger is KC_NO it means 'no key', so only the required modifiers need to be down.
-        const bool no_trigger = override->trigger == KC_NO;
+    // Check mods precisely
+    if (!key_override_matches_active_modifiers(override, active_mods)) {
+        key_override_printf("Not activating override: Modifiers don't match\n");
+        return false;
+    }
 
-        // Check if aleady active
-        if (override == active_override) {
-            key_override_printf("Not activating override: Alerady actived\n");
-            continue;
-        }
+    // Check if trigger key is down.
+    const bool trigger_down = is_trigger && key_down;
 
-        // Check if enabled
-        if (override->enabled != NULL && !((*(override->enabled) & 1))) {
-            key_override_printf("Not activating override: Not enabled\n");
-            continue;
-        }
+    // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
+    // If no trigger key is required, yes.
+    // If the trigger was just pressed, yes.
+    // If the last non-mod key that was pressed down is the trigger key, yes.
+    bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
 
-        // Check mods precisely
-        if (!key_override_matches_active_modifiers(override, active_mods)) {
-            key_override_printf("Not activating override: Modifiers don't match\n");
-            continue;
-        }
+    if (!should_activate) {
+        key_override_printf("Not activating override. Trigger not down\n");
+        return false;
+    }
 
-        // Check if trigger key is down.
-        const bool trigger_down = is_trigger && key_down;
+    key_override_printf("Activating override\n");
 
-        // At this point, all requirements for activation are checked, except whether the trigger key is pressed. Now we check if the required trigger is down
-        // If no trigger key is required, yes.
-        // If the trigger was just pressed, yes.
-        // If the last non-mod key that was pressed down is the trigger key, yes.
-        bool should_activate = no_trigger || trigger_down || last_key_down == override->trigger;
+    clear_active_override(false);
 
-        if (!should_activate) {
-            key_override_printf("Not activating override. Trigger not down\n");
-            continue;
-        }
+#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
+    // Send a dummy keycode before unregistering the modifier(s)
+    // so that suppressing the modifier(s) doesn't falsely get interpreted
+    // by the host OS as a tap of a modifier key.
+    // For example, unintended activations of the start menu on Windows when
+    // using a GUI+<kc> key override with suppressed mods.
+    neutralize_flashing_modifiers(active_mods);
+#endif
 
-        key_override_printf("Activating override\n");
+    active_override                 = override;
+    active_override_trigger_is_down = true;
 
-        clear_active_override(false);
+    set_suppressed_override_mods(override->suppressed_mods);
 
-#ifdef DUMMY_MOD_NEUTRALIZER_KEYCODE
-        // Send a dummy keycode before unregistering the modifier(s)
-        // so that suppressing the modifier(s) doesn't falsely get interpreted
-        // by the host OS as a tap of a modifier key.
-        // For example, unintended activations of the start menu on Windows when
-        // using a GUI+<kc> key override with suppressed mods.
-        neutralize_flashing_modifiers(active_mods);
-#endif
+    if (!trigger_down && !no_trigger) {
+        // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
+        if (IS_BASIC_KEYCODE(override->trigger)) {
+            del_key(override->trigger);
+        } else {
+            unregister_code(override->trigger);
+        }
+    }
 
-        active_override                 = override;
-        active_override_trigger_is_down = true;
+    const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
 
-        set_suppressed_override_mods(override->suppressed_mods);
+    bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
+                                mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+
+    // Try firing the custom handler
+    if (override->custom_action != NULL) {
+        register_replacement &= override->custom_action(true, override->context);
+    }
 
-        if (!trigger_down && !no_trigger) {
-            // When activating a key override the trigger is is always unregistered. In the case where the key that newly pressed is not the trigger key, we have to explicitly remove the trigger key from the keyboard report. If the trigger was just pressed down we simply suppress the event which also has the effect of the trigger key not being registered in the keyboard report.
-            if (IS_BASIC_KEYCODE(override->trigger)) {
-                del_key(override->trigger);
+    if (register_replacement) {
+        const uint8_t override_mods = extract_mod_bits(override->replacement);
+        set_weak_override_mods(override_mods);
+
+        // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
+        if (is_mod) {
+            key_override_printf("Deferring register replacement key\n");
+            schedule_deferred_register(mod_free_replacement);
+            send_keyboard_report();
+        } else {
+            if (IS_BASIC_KEYCODE(mod_free_replacement)) {
+                add_key(mod_free_replacement);
             } else {
-                unregister_code(override->trigger);
+                key_override_printf("NOT KEY 2\n");
+                send_keyboard_report();
+                // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
+                wait_ms(10);
+                register_code(mod_free_replacement);
             }
         }
+    } else {
+        // If not registering the replacement key send keyboard report to update the unregistered keys.
+        send_keyboard_report();
+    }
 
-        const uint16_t mod_free_replacement = clear_mods_from(override->replacement);
+    // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
+    *send_key_action = !trigger_down;
+    return true;
+}
 
-        bool register_replacement = mod_free_replacement != KC_NO &&   // KC_NO is never registered
-                                    mod_free_replacement < SAFE_RANGE; // Custom keycodes are never registered
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+static void build_key_override_lookup(void) {
+    key_override_lookup_size  = 0;
+    key_override_lookup_count = key_override_count();
+    key_override_lookup_state = KEY_OVERRIDE_LOOKUP_VALID;
 
-        // Try firing the custom handler
-        if (override->custom_action != NULL) {
-            register_replacement &= override->custom_action(true, override->context);
+    for (uint16_t i = 0; i < key_override_lookup_count; i++) {
+        const key_override_t *const override = key_override_get(i);
+
+        // End of array
+        if (override == NULL) {
+            break;
         }
 
-        if (register_replacement) {
-            const uint8_t override_mods = extract_mod_bits(override->replacement);
-            set_weak_override_mods(override_mods);
+        if (key_override_lookup_size >= KEY_OVERRIDE_INDEX_LENGTH) {
+            // Too many key overrides, fall back to checking every override
+            key_override_lookup_state = KEY_OVERRIDE_LOOKUP_OVERFLOW;
+            return;
+        }
 
-            // If this is a modifier event that activates the key override we _always_ defer the actual full activation of the override
-            if (is_mod) {
-                key_override_printf("Deferring register replacement key\n");
-                schedule_deferred_register(mod_free_replacement);
-                send_keyboard_report();
-            } else {
-                if (IS_BASIC_KEYCODE(mod_free_replacement)) {
-                    add_key(mod_free_replacement);
-                } else {
-                    key_override_printf("NOT KEY 2\n");
-                    send_keyboard_report();
-                    // On macOS there seems to be a race condition when it comes to the keyboard report and consumer keycodes. It seems the OS may recognize a consumer keycode before an updated keyboard report, even if the keyboard report is actually sent before the consumer key. I assume it is some sort of race condition because it happens infrequently and very irregularly. Waiting for about at least 10ms between sending the keyboard report and sending the consumer code has shown to fix this.
-                    wait_ms(10);
-                    register_code(mod_free_replacement);
+        // Insertion sort. Overrides are visited in ascending order, so entries sharing a trigger stay ordered by override index
+        uint16_t pos = key_override_lookup_size;
+        while (pos > 0 && key_override_lookup[pos - 1].trigger > override->trigger) {
+            key_override_lookup[pos] = key_override_lookup[pos - 1];
+            pos--;
+        }
+        key_override_lookup[pos] = (key_override_lookup_entry_t){
+            .trigger        = override->trigger,
+            .override_index = i,
+        };
+        key_override_lookup_size++;
+    }
+}
+
+/** Returns the position of the first lookup entry for the trigger, or key_override_lookup_size if no override uses it */
+static uint16_t key_override_lookup_find(const uint16_t trigger) {
+    uint16_t low = 0, high = key_override_lookup_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (key_override_lookup[mid].trigger < trigger) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
+/** Iterates through the list of key overrides and tries activating each, until it finds one that activates or reaches the end of overrides. Returns true if the key action for `keycode` should be sent */
+static bool try_activating_override(const uint16_t keycode, const uint8_t layer, const bool key_down, const bool is_mod, const uint8_t active_mods, bool *activated) {
+    if (key_override_count() == 0) {
+        return true;
+    }
+
+    bool send_key_action = true;
+
+#ifdef KEY_OVERRIDE_INDEX_LENGTH
+    if (key_override_lookup_state == KEY_OVERRIDE_LOOKUP_STALE || key_override_lookup_count != key_override_count()) {
+        build_key_override_lookup();
+    }
+
+    if (key_override_lookup_state == KEY_OVERRIDE_LOOKUP_VALID) {
+        // An override can only activate if its trigger is the key in this event, the last non-mod key pressed down, or 'no key'. Walk the lookup entries of those triggers together, in override order.
+        const uint16_t triggers[] = {KC_NO, keycode, last_key_down};
+        uint16_t       positions[ARRAY_SIZE(triggers)];
+        for (uint8_t t = 0; t < ARRAY_SIZE(triggers); t++) {
+            positions[t] = key_override_lookup_find(triggers[t]);
+            for (uint8_t u = 0; u < t; u++) {
+                if (triggers[u] == triggers[t]) {
+                    // Already walked through an earlier trigger
+                    positions[t] = key_override_lookup_size;
                 }
             }
-        } else {
-            // If not registering the replacement key send keyboard report to update the unregistered keys.
-            send_keyboard_report();
         }
 
-        *activated = true;
+        while (true) {
+            int8_t next = -1;
+            for (uint8_t t = 0; t < ARRAY_SIZE(triggers); t++) {
+                if (positions[t] < key_override_lookup_size && key_override_lookup[positions[t]].trigger == triggers[t]) {
+                    if (next < 0 || key_override_lookup[positions[t]].override_index < key_override_lookup[positions[next]].override_index) {
+                        next = t;
+                    }
+                }
+            }
+
+            if (next < 0) {
+                break;
+            }
+
+            const key_override_t *const override = key_override_get(key_override_lookup[positions[next]++].override_index);
+            if (try_activating_single_override(override, keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+                *activated = true;
+                return send_key_action;
+            }
+        }
+
+        *activated = false;
+        return true;
+    }
+#endif
+
+    for (uint16_t i = 0; i < key_override_count(); i++) {
+        const key_override_t *const override = key_override_get(i);
 
-        // If the trigger is down, suppress the event so that it does not get added to the keyboard report.
-        return !trigger_down;
+        // End of array
+        if (override == NULL) {
+            break;
+        }
+
+        if (try_activating_single_override(override, keycode, layer, key_down, is_mod, active_mods, &send_key_action)) {
+            *activated = true;
+            return send_key_action;
+        }
     }
 
     *activated = false;
@@ -99,6 +99,9 @@ void key_override_toggle(void);
 /** Returns whether key overrides are enabled */
 bool key_override_is_enabled(void);
 
+/** Rebuilds the key override index on the next key event, after overrides have been changed at runtime */
+void key_override_index_invalidate(void);
+
 /** Handling of key overrides and its implemented keycodes */
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record);
 
@@ -0,0 +1,232 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiling.h"
+#include "timer.h"
+#include "print.h"
+#include "util.h"
+#ifdef RAW_ENABLE
+#    include "raw_hid.h"
+#endif
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#elif defined(__AVR__)
+#    include <avr/io.h>
+#    include <util/atomic.h>
+#    include "timer_avr.h"
+#endif
+
+static const char *const task_names[PROFILING_TASK_COUNT] = {
+    [PROFILING_TASK_LOOP]             = "loop",
+    [PROFILING_TASK_MATRIX]           = "matrix",
+    [PROFILING_TASK_SPLIT_TRANSPORT]  = "split_transport",
+    [PROFILING_TASK_QUANTUM]          = "quantum",
+    [PROFILING_TASK_SPLIT_WATCHDOG]   = "split_watchdog",
+    [PROFILING_TASK_RGBLIGHT]         = "rgblight",
+    [PROFILING_TASK_LED_MATRIX]       = "led_matrix",
+    [PROFILING_TASK_RGB_MATRIX]       = "rgb_matrix",
+    [PROFILING_TASK_BACKLIGHT]        = "backlight",
+    [PROFILING_TASK_ENCODER]          = "encoder",
+    [PROFILING_TASK_POINTING_DEVICE]  = "pointing_device",
+    [PROFILING_TASK_OLED]             = "oled",
+    [PROFILING_TASK_ST7565]           = "st7565",
+    [PROFILING_TASK_MOUSEKEY]         = "mousekey",
+    [PROFILING_TASK_PS2_MOUSE]        = "ps2_mouse",
+    [PROFILING_TASK_MIDI]             = "midi",
+    [PROFILING_TASK_JOYSTICK]         = "joystick",
+    [PROFILING_TASK_BATTERY]          = "battery",
+    [PROFILING_TASK_BLUETOOTH]        = "bluetooth",
+    [PROFILING_TASK_HAPTIC]           = "haptic",
+    [PROFILING_TASK_LED]              = "led",
+    [PROFILING_TASK_OS_DETECTION]     = "os_detection",
+    [PROFILING_TASK_RAW_HID]          = "raw_hid",
+    [PROFILING_TASK_CONSOLE]          = "console",
+    [PROFILING_TASK_QUANTUM_PAINTER]  = "quantum_painter",
+    [PROFILING_TASK_DEFERRED_EXEC]    = "deferred_exec",
+    [PROFILING_TASK_HOUSEKEEPING]     = "housekeeping",
+    [PROFILING_TASK_USER]             = "user",
+};
+
+static profiling_stats_t stats[PROFILING_TASK_COUNT];
+static uint32_t          start_timestamps[PROFILING_TASK_COUNT];
+static uint32_t          reset_time = 0;
+
+#if defined(__AVR__)
+extern volatile uint32_t timer_count;
+
+#    if defined(__AVR_ATmega32A__)
+#        define PROFILING_TIMER_MATCH_PENDING() (TIFR & _BV(OCF0))
+#    elif defined(__AVR_ATtiny85__)
+#        define PROFILING_TIMER_MATCH_PENDING() (TIFR & _BV(OCF0A))
+#    else
+#        define PROFILING_TIMER_MATCH_PENDING() (TIFR0 & _BV(OCF0A))
+#    endif
+#endif
+
+__attribute__((weak)) uint32_t profiling_timestamp(void) {
+#if defined(PROTOCOL_CHIBIOS) && PORT_SUPPORTS_RT == TRUE
+    return chSysGetRealtimeCounterX();
+#elif defined(PROTOCOL_CHIBIOS) && CH_CFG_ST_RESOLUTION == 32
+    return chVTGetSystemTimeX();
+#elif defined(__AVR__)
+    // Timer0 counts up to TIMER_RAW_TOP once every millisecond, append its count to the milliseconds
+    uint32_t ms;
+    uint8_t  raw;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        ms  = timer_count;
+        raw = TIMER_RAW;
+        // The millisecond has just ended, but its interrupt has not run yet
+        if (PROFILING_TIMER_MATCH_PENDING()) {
+            ms++;
+            raw = TIMER_RAW;
+        }
+    }
+    return ms * (TIMER_RAW_TOP + 1) + raw;
+#else
+    return timer_read32();
+#endif
+}
+
+void profiling_begin(profiling_task_t task) {
+    start_timestamps[task] = profiling_timestamp();
+}
+
+static uint8_t histogram_bucket(uint32_t duration) {
+    uint8_t bucket = duration ? sizeof(unsigned long) * 8 - __builtin_clzl(duration) : 0;
+    return MIN(bucket, PROFILING_HISTOGRAM_BUCKETS - 1);
+}
+
+void profiling_end(profiling_task_t task) {
+    uint32_t           duration = profiling_timestamp() - start_timestamps[task];
+    profiling_stats_t *s        = &stats[task];
+
+    if (s->count == 0 || duration < s->min) {
+        s->min = duration;
+    }
+    if (duration > s->max) {
+        s->max = duration;
+    }
+    s->total += duration;
+    if (s->count < UINT32_MAX) {
+        s->count++;
+    }
+
+    uint16_t *bucket = &s->histogram[histogram_bucket(duration)];
+    if (*bucket < UINT16_MAX) {
+        (*bucket)++;
+    }
+}
+
+const profiling_stats_t *profiling_get_stats(profiling_task_t task) {
+    return task < PROFILING_TASK_COUNT ? &stats[task] : NULL;
+}
+
+const char *profiling_get_task_name(profiling_task_t task) {
+    return task < PROFILING_TASK_COUNT ? task_names[task] : NULL;
+}
+
+static uint32_t average(const profiling_stats_t *s) {
+    return s->count ? s->total / s->count : 0;
+}
+
+uint32_t profiling_elapsed(void) {
+    return timer_elapsed32(reset_time);
+}
+
+void profiling_reset(void) {
+    memset(stats, 0, sizeof(stats));
+    reset_time = timer_read32();
+}
+
+void profiling_print(void) {
+    uprintf("profiling: %lu loops in %lu ms\n", (unsigned long)stats[PROFILING_TASK_LOOP].count, (unsigned long)profiling_elapsed());
+    for (uint8_t task = 0; task < PROFILING_TASK_COUNT; task++) {
+        const profiling_stats_t *s = &stats[task];
+        if (s->count == 0) {
+            continue;
+        }
+
+        uprintf("%-16s n=%-8lu min=%-8lu avg=%-8lu max=%-8lu |", task_names[task], (unsigned long)s->count, (unsigned long)s->min, (unsigned long)average(s), (unsigned long)s->max);
+        for (uint8_t i = 0; i <= histogram_bucket(s->max); i++) {
+            uprintf(" %u", s->histogram[i]);
+        }
+        uprintf("\n");
+    }
+}
+
+void profiling_task(void) {
+#ifdef PROFILING_PRINT_INTERVAL
+    if (profiling_elapsed() >= PROFILING_PRINT_INTERVAL) {
+        profiling_print();
+        profiling_reset();
+    }
+#endif
+}
+
+static void put_u32_be(uint8_t *data, uint32_t value) {
+    data[0] = (value >> 24) & 0xFF;
+    data[1] = (value >> 16) & 0xFF;
+    data[2] = (value >> 8) & 0xFF;
+    data[3] = value & 0xFF;
+}
+
+/* Command layout: PROFILING_RAW_HID_COMMAND, sub-command, arguments.
+ * Replies reuse the buffer, an unknown sub-command or task comes back as 0xFF. */
+bool profiling_raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length < 20 || data[0] != PROFILING_RAW_HID_COMMAND) {
+        return false;
+    }
+
+    uint8_t *command_data = &data[2];
+    switch (data[1]) {
+        case id_profiling_get_info: {
+            command_data[0] = PROFILING_TASK_COUNT;
+            command_data[1] = PROFILING_HISTOGRAM_BUCKETS;
+            put_u32_be(&command_data[2], profiling_elapsed());
+            break;
+        }
+        case id_profiling_get_stats: {
+            const profiling_stats_t *s = profiling_get_stats(command_data[0]);
+            if (!s) {
+                data[1] = 0xFF;
+                break;
+            }
+            put_u32_be(&command_data[1], s->count);
+            put_u32_be(&command_data[5], s->min);
+            put_u32_be(&command_data[9], s->max);
+            put_u32_be(&command_data[13], average(s));
+            // Name is truncated to what is left of the report
+            strncpy((char *)&command_data[17], task_names[command_data[0]], length - 20);
+            data[length - 1] = 0;
+            break;
+        }
+        case id_profiling_get_histogram: {
+            const profiling_stats_t *s = profiling_get_stats(command_data[0]);
+            if (!s) {
+                data[1] = 0xFF;
+                break;
+            }
+            // As many 16-bit buckets as fit, starting from the requested one
+            for (uint8_t i = 0, bucket = command_data[1]; i + 5 < length; i += 2, bucket++) {
+                uint16_t value      = bucket < PROFILING_HISTOGRAM_BUCKETS ? s->histogram[bucket] : 0;
+                command_data[i + 2] = value >> 8;
+                command_data[i + 3] = value & 0xFF;
+            }
+            break;
+        }
+        case id_profiling_reset: {
+            profiling_reset();
+            break;
+        }
+        default: {
+            data[1] = 0xFF;
+            break;
+        }
+    }
+
+#ifdef RAW_ENABLE
+    raw_hid_send(data, length);
+#endif
+    return true;
+}
@@ -0,0 +1,116 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Per-task timing of the main loop, enabled with PROFILING_ENABLE = yes.
+
+    Each instrumented task keeps min/avg/max and a log2 histogram of the
+    timestamp ticks it took, see profiling_timestamp(). Results are printed
+    with profiling_print() or queried over raw HID.
+
+    The PROFILING_BEGIN()/PROFILING_END() macros always compile, and expand
+    to nothing when the feature is disabled:
+
+        PROFILING_BEGIN(PROFILING_TASK_USER);
+        my_expensive_task();
+        PROFILING_END(PROFILING_TASK_USER);
+*/
+
+typedef enum profiling_task_t {
+    PROFILING_TASK_LOOP,
+    PROFILING_TASK_MATRIX,
+    PROFILING_TASK_SPLIT_TRANSPORT,
+    PROFILING_TASK_QUANTUM,
+    PROFILING_TASK_SPLIT_WATCHDOG,
+    PROFILING_TASK_RGBLIGHT,
+    PROFILING_TASK_LED_MATRIX,
+    PROFILING_TASK_RGB_MATRIX,
+    PROFILING_TASK_BACKLIGHT,
+    PROFILING_TASK_ENCODER,
+    PROFILING_TASK_POINTING_DEVICE,
+    PROFILING_TASK_OLED,
+    PROFILING_TASK_ST7565,
+    PROFILING_TASK_MOUSEKEY,
+    PROFILING_TASK_PS2_MOUSE,
+    PROFILING_TASK_MIDI,
+    PROFILING_TASK_JOYSTICK,
+    PROFILING_TASK_BATTERY,
+    PROFILING_TASK_BLUETOOTH,
+    PROFILING_TASK_HAPTIC,
+    PROFILING_TASK_LED,
+    PROFILING_TASK_OS_DETECTION,
+    PROFILING_TASK_RAW_HID,
+    PROFILING_TASK_CONSOLE,
+    PROFILING_TASK_QUANTUM_PAINTER,
+    PROFILING_TASK_DEFERRED_EXEC,
+    PROFILING_TASK_HOUSEKEEPING,
+    PROFILING_TASK_USER,
+    PROFILING_TASK_COUNT,
+} profiling_task_t;
+
+#ifndef PROFILING_HISTOGRAM_BUCKETS
+#    define PROFILING_HISTOGRAM_BUCKETS 24
+#endif
+
+#ifndef PROFILING_RAW_HID_COMMAND
+#    define PROFILING_RAW_HID_COMMAND 0xF0
+#endif
+
+typedef enum profiling_raw_hid_command_t {
+    id_profiling_get_info      = 0x01,
+    id_profiling_get_stats     = 0x02,
+    id_profiling_get_histogram = 0x03,
+    id_profiling_reset         = 0x04,
+} profiling_raw_hid_command_t;
+
+typedef struct profiling_stats_t {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+    uint16_t histogram[PROFILING_HISTOGRAM_BUCKETS]; // bucket n counts durations of n significant bits, saturating
+} profiling_stats_t;
+
+/**
+ * \brief Timestamp the durations are measured in.
+ *
+ * Defaults to the ChibiOS realtime counter, usually the CPU cycle counter,
+ * and to the millisecond timer elsewhere. Can be overridden with a higher
+ * resolution source.
+ */
+uint32_t profiling_timestamp(void);
+
+void profiling_begin(profiling_task_t task);
+void profiling_end(profiling_task_t task);
+
+const profiling_stats_t *profiling_get_stats(profiling_task_t task);
+const char *             profiling_get_task_name(profiling_task_t task);
+
+/**
+ * \brief Milliseconds covered by the current statistics.
+ */
+uint32_t profiling_elapsed(void);
+
+void profiling_reset(void);
+void profiling_print(void);
+void profiling_task(void);
+
+/**
+ * \brief Handle a profiling query received over raw HID.
+ *
+ * \return true if the report was a profiling command and has been answered.
+ */
+bool profiling_raw_hid_receive(uint8_t *data, uint8_t length);
+
+#ifdef PROFILING_ENABLE
+#    define PROFILING_BEGIN(task) profiling_begin(task)
+#    define PROFILING_END(task) profiling_end(task)
+#else
+#    define PROFILING_BEGIN(task)
+#    define PROFILING_END(task)
+#endif
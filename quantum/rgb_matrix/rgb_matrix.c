@@ -18,6 +18,7 @@
 
 #include "rgb_matrix.h"
 #include "progmem.h"
+#include "compiler_support.h"
 #include "eeconfig.h"
 #include "keyboard.h"
 #include "sync_timer.h"
@@ -38,6 +39,49 @@ __attribute__((weak)) rgb_t rgb_matrix_hsv_to_rgb(hsv_t hsv) {
     return hsv_to_rgb(hsv);
 }
 
+#ifdef RGB_MATRIX_LED_DISTANCE_CACHE
+// Stop the distance cache from taking up too much of the RAM on smaller MCUs
+#    ifndef RGB_MATRIX_LED_DISTANCE_CACHE_MAX_SIZE
+#        if defined(__AVR__)
+#            define RGB_MATRIX_LED_DISTANCE_CACHE_MAX_SIZE 512
+#        else
+#            define RGB_MATRIX_LED_DISTANCE_CACHE_MAX_SIZE 8192
+#        endif
+#    endif
+
+STATIC_ASSERT(RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2 <= RGB_MATRIX_LED_DISTANCE_CACHE_MAX_SIZE, "RGB_MATRIX_LED_DISTANCE_CACHE is too large, reduce RGB_MATRIX_LED_COUNT or raise RGB_MATRIX_LED_DISTANCE_CACHE_MAX_SIZE.");
+
+// Distance between every pair of LEDs, lower triangle without the diagonal
+static uint8_t led_distance_cache[RGB_MATRIX_LED_COUNT * (RGB_MATRIX_LED_COUNT - 1) / 2];
+
+static inline uint16_t led_distance_cache_index(uint8_t led_a, uint8_t led_b) {
+    return (uint16_t)led_a * (led_a - 1) / 2 + led_b;
+}
+
+void rgb_matrix_update_led_distances(void) {
+    for (uint8_t led_a = 1; led_a < RGB_MATRIX_LED_COUNT; led_a++) {
+        for (uint8_t led_b = 0; led_b < led_a; led_b++) {
+            int16_t dx = g_led_config.point[led_a].x - g_led_config.point[led_b].x;
+            int16_t dy = g_led_config.point[led_a].y - g_led_config.point[led_b].y;
+
+            led_distance_cache[led_distance_cache_index(led_a, led_b)] = sqrt16(dx * dx + dy * dy);
+        }
+    }
+}
+
+uint8_t rgb_matrix_led_distance(uint8_t led_a, uint8_t led_b) {
+    if (led_a == led_b) {
+        return 0;
+    }
+    if (led_a < led_b) {
+        uint8_t swap = led_a;
+        led_a        = led_b;
+        led_b        = swap;
+    }
+    return led_distance_cache[led_distance_cache_index(led_a, led_b)];
+}
+#endif // RGB_MATRIX_LED_DISTANCE_CACHE
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -490,6 +534,10 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_LED_DISTANCE_CACHE
+    rgb_matrix_update_led_distances();
+#endif // RGB_MATRIX_LED_DISTANCE_CACHE
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -172,6 +172,12 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
 
+#ifdef RGB_MATRIX_LED_DISTANCE_CACHE
+// Recalculate the cached distances after changing g_led_config at runtime
+void    rgb_matrix_update_led_distances(void);
+uint8_t rgb_matrix_led_distance(uint8_t led_a, uint8_t led_b);
+#endif
+
 void rgb_matrix_reload_from_eeprom(void);
 
 void        rgb_matrix_set_suspend_state(bool state);
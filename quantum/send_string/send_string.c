@@ -24,6 +24,14 @@
 #include "action.h"
 #include "wait.h"
 
+#ifdef SEND_STRING_BATCH_SIZE
+#    include "action_util.h"
+#    include "host.h"
+#    include "keycode_config.h"
+#    include "report.h"
+#    include "util.h"
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -150,9 +158,128 @@ void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
 
+#ifdef SEND_STRING_BATCH_SIZE
+/* Characters waiting to be sent together, as one report pressing all of
+ * their keys followed by one report releasing them. Hosts handle keys that
+ * are pressed in the same report in report order, so only distinct keys
+ * sharing the same modifiers can be combined.
+ */
+typedef struct send_string_batch_t {
+    char    chars[SEND_STRING_BATCH_SIZE];
+    uint8_t keycodes[SEND_STRING_BATCH_SIZE];
+    uint8_t count;
+} send_string_batch_t;
+
+static bool send_string_batch_is_nkro(void) {
+#    ifdef NKRO_ENABLE
+    return host_can_send_nkro() && keymap_config.nkro;
+#    else
+    return false;
+#    endif
+}
+
+static void send_string_batch_flush(send_string_batch_t *batch, uint8_t interval) {
+    if (batch->count == 0) return;
+
+    if (batch->count == 1) {
+        send_char_with_delay(batch->chars[0], interval);
+        batch->count = 0;
+        return;
+    }
+
+    bool is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)batch->chars[0]);
+    bool is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)batch->chars[0]);
+
+    if (is_shifted) {
+        register_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+
+    if (is_altgred) {
+        register_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+
+    for (uint8_t i = 0; i < batch->count; i++) {
+        add_key(batch->keycodes[i]);
+    }
+    send_keyboard_report();
+    wait_ms(interval);
+
+    for (uint8_t i = 0; i < batch->count; i++) {
+        del_key(batch->keycodes[i]);
+    }
+    send_keyboard_report();
+    wait_ms(interval);
+
+    if (is_altgred) {
+        unregister_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+
+    if (is_shifted) {
+        unregister_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+
+    batch->count = 0;
+}
+
+/* Adds a character to the batch, sending the pending characters first if it
+ * can't be combined with them. Returns false if the character needs to be
+ * sent on its own with send_char_with_delay().
+ */
+static bool send_string_batch_add(send_string_batch_t *batch, char ascii_code, uint8_t interval) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') return false;
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    // Dead keys need a space tapped after them, and locking keys are handled specially by register_code()
+    if (is_dead || keycode < KC_A || keycode > KC_EXSEL || (keycode >= KC_LOCKING_CAPS_LOCK && keycode <= KC_LOCKING_SCROLL_LOCK)) return false;
+
+    if (batch->count > 0) {
+        // The NKRO bitmap has no ordering, so hosts see its keys in ascending keycode order
+        bool    is_nkro  = send_string_batch_is_nkro();
+        uint8_t capacity = is_nkro ? SEND_STRING_BATCH_SIZE : MIN(SEND_STRING_BATCH_SIZE, KEYBOARD_REPORT_KEYS - has_anykey());
+        bool    fits     = batch->count < capacity && is_shifted == PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)batch->chars[0]) && is_altgred == PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)batch->chars[0]);
+
+        if (is_nkro && keycode <= batch->keycodes[batch->count - 1]) {
+            fits = false;
+        }
+        for (uint8_t i = 0; fits && i < batch->count; i++) {
+            if (batch->keycodes[i] == keycode) {
+                fits = false;
+            }
+        }
+
+        if (!fits) {
+            send_string_batch_flush(batch, interval);
+        }
+    }
+
+    batch->chars[batch->count]    = ascii_code;
+    batch->keycodes[batch->count] = keycode;
+    batch->count++;
+    return true;
+}
+#endif
+
 void send_string_with_delay_impl(char (*getter)(void *), void *arg, uint8_t interval) {
+#ifdef SEND_STRING_BATCH_SIZE
+    send_string_batch_t batch = {.count = 0};
+#endif
+
     while (1) {
         char ascii_code = getter(arg);
+#ifdef SEND_STRING_BATCH_SIZE
+        if (ascii_code && ascii_code != SS_QMK_PREFIX && send_string_batch_add(&batch, ascii_code, interval)) continue;
+        send_string_batch_flush(&batch, interval);
+#endif
         if (!ascii_code) break;
         if (ascii_code == SS_QMK_PREFIX) {
             ascii_code = getter(arg);
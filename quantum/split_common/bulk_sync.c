@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include <string.h>
+
+#include "bulk_sync.h"
+#include "compiler_support.h"
+#include "crc.h"
+
+#ifdef SPLIT_BULK_SYNC
+
+STATIC_ASSERT(sizeof(split_bulk_sync_request_t) <= UINT8_MAX, "SPLIT_BULK_SYNC_PAYLOAD_SIZE too large");
+
+static inline uint8_t split_bulk_sync_checksum(const split_bulk_sync_request_t *request) {
+    return crc8(request, offsetof(split_bulk_sync_request_t, payload) + request->length);
+}
+
+bool split_bulk_sync_can_stage(int8_t id) {
+    const split_transaction_desc_t *trans = &split_transaction_table[id];
+    return trans->initiator2target_buffer_size > 0 && trans->initiator2target_buffer_size <= SPLIT_BULK_SYNC_PAYLOAD_SIZE && !trans->target2initiator_buffer_size && !trans->slave_callback;
+}
+
+void split_bulk_sync_pack(split_bulk_sync_request_t *request, const uint8_t pending[SPLIT_BULK_SYNC_REGION_BYTES]) {
+    memset(request, 0, sizeof(split_bulk_sync_request_t));
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        const split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!split_bulk_sync_region_get(pending, id) || request->length + trans->initiator2target_buffer_size > sizeof(request->payload)) {
+            continue;
+        }
+        memcpy(&request->payload[request->length], split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        request->length += trans->initiator2target_buffer_size;
+        split_bulk_sync_region_set(request->regions, id);
+    }
+    request->checksum = split_bulk_sync_checksum(request);
+}
+
+bool split_bulk_sync_unpack(const split_bulk_sync_request_t *request) {
+    if (request->length > sizeof(request->payload) || split_bulk_sync_checksum(request) != request->checksum) {
+        return false;
+    }
+
+    // Check that the flagged regions add up to the payload before touching anything
+    uint16_t length = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (split_bulk_sync_region_get(request->regions, id)) {
+            length += split_transaction_table[id].initiator2target_buffer_size;
+        }
+    }
+    if (length != request->length) {
+        return false;
+    }
+
+    uint8_t offset = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!split_bulk_sync_region_get(request->regions, id)) {
+            continue;
+        }
+        const split_transaction_desc_t *trans = &split_transaction_table[id];
+        memcpy(split_trans_initiator2target_buffer(trans), &request->payload[offset], trans->initiator2target_buffer_size);
+        offset += trans->initiator2target_buffer_size;
+    }
+    return true;
+}
+
+#endif // SPLIT_BULK_SYNC
@@ -0,0 +1,43 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "transactions.h"
+
+#ifdef SPLIT_BULK_SYNC
+
+static inline bool split_bulk_sync_region_get(const uint8_t regions[], int8_t id) {
+    return (regions[id / 8] & (1 << (id % 8))) != 0;
+}
+
+static inline void split_bulk_sync_region_set(uint8_t regions[], int8_t id) {
+    regions[id / 8] |= 1 << (id % 8);
+}
+
+/**
+ * \brief Whether the master to slave data of a transaction can be carried by a bulk sync frame.
+ *
+ * Transactions that reply, run a slave callback, or don't fit in the payload have to be sent on their own.
+ */
+bool split_bulk_sync_can_stage(int8_t id);
+
+/**
+ * \brief Packs the shared memory regions of the pending transactions into a bulk sync request.
+ *
+ * Regions are packed in ascending order of transaction ID, skipping any that no longer fit, which are left for
+ * another frame. The regions actually packed are flagged in `request->regions`.
+ */
+void split_bulk_sync_pack(split_bulk_sync_request_t *request, const uint8_t pending[SPLIT_BULK_SYNC_REGION_BYTES]);
+
+/**
+ * \brief Copies each region packed in a bulk sync request back into shared memory.
+ *
+ * Returns false, leaving shared memory untouched, if the checksum or the length of the request is wrong.
+ */
+bool split_bulk_sync_unpack(const split_bulk_sync_request_t *request);
+
+#endif // SPLIT_BULK_SYNC
@@ -24,6 +24,7 @@
 #include "debug.h"
 #include "usb_util.h"
 #include "bootloader.h"
+#include "profiling.h"
 
 #ifdef EE_HANDS
 #    include "eeconfig.h"
@@ -246,7 +247,9 @@ bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t sl
     }
 #endif // SPLIT_MAX_CONNECTION_ERRORS > 0 && SPLIT_CONNECTION_CHECK_TIMEOUT > 0
 
+    PROFILING_BEGIN(PROFILING_TASK_SPLIT_TRANSPORT);
     __attribute__((unused)) bool okay = transport_master(master_matrix, slave_matrix);
+    PROFILING_END(PROFILING_TASK_SPLIT_TRANSPORT);
 #if SPLIT_MAX_CONNECTION_ERRORS > 0
     if (!okay) {
         if (connection_errors < UINT8_MAX) {
@@ -0,0 +1,198 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "bulk_sync.h"
+#include "crc.h"
+}
+
+// Shared memory, followed by the regions of the test transactions
+static struct {
+    split_shared_memory_t shmem;
+    uint8_t               regions[NUM_TOTAL_TRANSACTIONS][24];
+} memory;
+
+extern "C" {
+split_shared_memory_t *const split_shmem = &memory.shmem;
+split_transaction_desc_t     split_transaction_table[NUM_TOTAL_TRANSACTIONS];
+
+static void test_slave_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {}
+}
+
+static uint8_t *region(int8_t id) {
+    return memory.regions[id];
+}
+
+class SplitBulkSync : public testing::Test {
+   protected:
+    void SetUp() override {
+        memset(&memory, 0, sizeof(memory));
+        memset(split_transaction_table, 0, sizeof(split_transaction_table));
+        memset(pending, 0, sizeof(pending));
+
+        add_region(PUT_SYNC_TIMER, 4);
+        add_region(TEST_REGION_A, 6);
+        add_region(TEST_REGION_B, 1);
+        add_region(TEST_REGION_C, 8);
+        add_region(TEST_REGION_TOO_LARGE, SPLIT_BULK_SYNC_PAYLOAD_SIZE + 1);
+        add_region(TEST_REGION_WITH_REPLY, 2);
+        split_transaction_table[TEST_REGION_WITH_REPLY].target2initiator_buffer_size = 2;
+        split_transaction_table[TEST_REGION_WITH_REPLY].target2initiator_offset      = region(TEST_REGION_WITH_REPLY) + 8 - (uint8_t *)split_shmem;
+        add_region(TEST_REGION_WITH_CALLBACK, 2);
+        split_transaction_table[TEST_REGION_WITH_CALLBACK].slave_callback = test_slave_callback;
+    }
+
+    void add_region(int8_t id, uint8_t size) {
+        split_transaction_table[id].initiator2target_buffer_size = size;
+        split_transaction_table[id].initiator2target_offset      = region(id) - (uint8_t *)split_shmem;
+    }
+
+    // Fills the region with a pattern unique to the transaction, and marks it pending
+    void stage(int8_t id) {
+        for (uint8_t i = 0; i < split_transaction_table[id].initiator2target_buffer_size; i++) {
+            region(id)[i] = (id << 4) + i + 1;
+        }
+        split_bulk_sync_region_set(pending, id);
+    }
+
+    void expect_staged_data(int8_t id) {
+        for (uint8_t i = 0; i < split_transaction_table[id].initiator2target_buffer_size; i++) {
+            EXPECT_EQ(region(id)[i], (uint8_t)((id << 4) + i + 1)) << "transaction " << +id << ", byte " << +i;
+        }
+    }
+
+    void expect_cleared(int8_t id) {
+        for (uint8_t i = 0; i < split_transaction_table[id].initiator2target_buffer_size; i++) {
+            EXPECT_EQ(region(id)[i], 0) << "transaction " << +id << ", byte " << +i;
+        }
+    }
+
+    // The slave side shares the memory of the master in the tests, so wipe it before unpacking
+    void clear_regions(void) {
+        memset(memory.regions, 0, sizeof(memory.regions));
+    }
+
+    uint8_t pending[SPLIT_BULK_SYNC_REGION_BYTES];
+};
+
+TEST_F(SplitBulkSync, RegionBitmapCoversEveryTransaction) {
+    EXPECT_GT(TEST_REGION_WITH_CALLBACK, 8);
+    EXPECT_EQ(SPLIT_BULK_SYNC_REGION_BYTES, (NUM_TOTAL_TRANSACTIONS + 7) / 8);
+}
+
+TEST_F(SplitBulkSync, PackAndUnpack) {
+    stage(PUT_SYNC_TIMER);
+    stage(TEST_REGION_A);
+    stage(TEST_REGION_B);
+
+    split_bulk_sync_request_t request;
+    split_bulk_sync_pack(&request, pending);
+    EXPECT_EQ(request.length, 4 + 6 + 1);
+    EXPECT_TRUE(split_bulk_sync_region_get(request.regions, PUT_SYNC_TIMER));
+    EXPECT_TRUE(split_bulk_sync_region_get(request.regions, TEST_REGION_A));
+    EXPECT_TRUE(split_bulk_sync_region_get(request.regions, TEST_REGION_B));
+    EXPECT_FALSE(split_bulk_sync_region_get(request.regions, TEST_REGION_C));
+
+    clear_regions();
+    EXPECT_TRUE(split_bulk_sync_unpack(&request));
+    expect_staged_data(PUT_SYNC_TIMER);
+    expect_staged_data(TEST_REGION_A);
+    expect_staged_data(TEST_REGION_B);
+    expect_cleared(TEST_REGION_C);
+}
+
+TEST_F(SplitBulkSync, RegionsThatDontFitWaitForNextFrame) {
+    stage(PUT_SYNC_TIMER);
+    stage(TEST_REGION_A);
+    stage(TEST_REGION_B);
+    stage(TEST_REGION_C);
+
+    // 4 + 6 + 1 bytes fit in the 16 byte payload, the 8 bytes of region C don't
+    split_bulk_sync_request_t first;
+    split_bulk_sync_pack(&first, pending);
+    EXPECT_EQ(first.length, 4 + 6 + 1);
+    EXPECT_FALSE(split_bulk_sync_region_get(first.regions, TEST_REGION_C));
+
+    for (uint8_t i = 0; i < SPLIT_BULK_SYNC_REGION_BYTES; i++) {
+        pending[i] &= ~first.regions[i];
+    }
+    split_bulk_sync_request_t second;
+    split_bulk_sync_pack(&second, pending);
+    EXPECT_EQ(second.length, 8);
+    EXPECT_TRUE(split_bulk_sync_region_get(second.regions, TEST_REGION_C));
+
+    clear_regions();
+    EXPECT_TRUE(split_bulk_sync_unpack(&first));
+    EXPECT_TRUE(split_bulk_sync_unpack(&second));
+    expect_staged_data(PUT_SYNC_TIMER);
+    expect_staged_data(TEST_REGION_A);
+    expect_staged_data(TEST_REGION_B);
+    expect_staged_data(TEST_REGION_C);
+}
+
+TEST_F(SplitBulkSync, UnsuitableTransactionsAreSentOnTheirOwn) {
+    EXPECT_TRUE(split_bulk_sync_can_stage(PUT_SYNC_TIMER));
+    EXPECT_TRUE(split_bulk_sync_can_stage(TEST_REGION_A));
+    EXPECT_FALSE(split_bulk_sync_can_stage(TEST_REGION_TOO_LARGE));
+    EXPECT_FALSE(split_bulk_sync_can_stage(TEST_REGION_WITH_REPLY));
+    EXPECT_FALSE(split_bulk_sync_can_stage(TEST_REGION_WITH_CALLBACK));
+    EXPECT_FALSE(split_bulk_sync_can_stage(GET_SLAVE_MATRIX_CHECKSUM));
+}
+
+TEST_F(SplitBulkSync, CorruptPayloadIsRejected) {
+    stage(TEST_REGION_A);
+    stage(TEST_REGION_C);
+
+    split_bulk_sync_request_t request;
+    split_bulk_sync_pack(&request, pending);
+    request.payload[3] ^= 0x10;
+
+    clear_regions();
+    EXPECT_FALSE(split_bulk_sync_unpack(&request));
+    expect_cleared(TEST_REGION_A);
+    expect_cleared(TEST_REGION_C);
+}
+
+TEST_F(SplitBulkSync, CorruptRegionsAreRejected) {
+    stage(TEST_REGION_A);
+
+    split_bulk_sync_request_t request;
+    split_bulk_sync_pack(&request, pending);
+    split_bulk_sync_region_set(request.regions, TEST_REGION_B);
+
+    clear_regions();
+    EXPECT_FALSE(split_bulk_sync_unpack(&request));
+    expect_cleared(TEST_REGION_A);
+    expect_cleared(TEST_REGION_B);
+}
+
+TEST_F(SplitBulkSync, OversizedLengthIsRejected) {
+    stage(TEST_REGION_A);
+
+    split_bulk_sync_request_t request;
+    split_bulk_sync_pack(&request, pending);
+    request.length = sizeof(request.payload) + 1;
+
+    clear_regions();
+    EXPECT_FALSE(split_bulk_sync_unpack(&request));
+    expect_cleared(TEST_REGION_A);
+}
+
+TEST_F(SplitBulkSync, RegionsMismatchingLengthAreRejected) {
+    stage(TEST_REGION_A);
+    stage(TEST_REGION_B);
+
+    // A valid checksum, but the flagged regions no longer add up to the payload
+    split_bulk_sync_request_t request;
+    split_bulk_sync_pack(&request, pending);
+    split_bulk_sync_region_set(request.regions, TEST_REGION_C);
+    request.checksum = crc8(&request, offsetof(split_bulk_sync_request_t, payload) + request.length);
+
+    clear_regions();
+    EXPECT_FALSE(split_bulk_sync_unpack(&request));
+    expect_cleared(TEST_REGION_A);
+    expect_cleared(TEST_REGION_B);
+    expect_cleared(TEST_REGION_C);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 4
+
+#define SPLIT_BULK_SYNC_PAYLOAD_SIZE 16
+
+// Transactions used as bulk sync regions by the tests, numbered past the first byte of the region bitmap
+#define SPLIT_TRANSACTION_IDS_USER TEST_REGION_A, TEST_REGION_B, TEST_REGION_C, TEST_REGION_TOO_LARGE, TEST_REGION_WITH_REPLY, TEST_REGION_WITH_CALLBACK
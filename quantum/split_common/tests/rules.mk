@@ -0,0 +1,8 @@
+split_bulk_sync_DEFS := -DSPLIT_KEYBOARD -DSPLIT_BULK_SYNC -DNO_PRINT
+split_bulk_sync_INC := $(QUANTUM_PATH)/split_common
+split_bulk_sync_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_bulk_sync.h
+
+split_bulk_sync_SRC := \
+	$(QUANTUM_PATH)/split_common/tests/bulk_sync_tests.cpp \
+	$(QUANTUM_PATH)/split_common/bulk_sync.c \
+	$(QUANTUM_PATH)/crc.c
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <stddef.h>
 
+#include "compiler_support.h"
 #include "crc.h"
 #include "debug.h"
 #include "matrix.h"
@@ -27,9 +28,13 @@
 #include "wait.h"
 #include "transactions.h"
 #include "transport.h"
+#ifdef SPLIT_BULK_SYNC
+#    include "bulk_sync.h"
+#endif
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "util.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -85,6 +90,16 @@
 #define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
 #define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
 
+#ifdef SPLIT_BULK_SYNC
+// Transactions staged for the next bulk sync frame
+static uint8_t bulk_sync_pending[SPLIT_BULK_SYNC_REGION_BYTES] = {0};
+static bool    bulk_sync_stage(int8_t id, const void *data, size_t length);
+// Master to slave syncs are collected and sent in a single bulk transaction
+#    define transport_put(id, data, length) bulk_sync_stage(id, data, length)
+#else
+#    define transport_put(id, data, length) transport_write(id, data, length)
+#endif // SPLIT_BULK_SYNC
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
 void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
@@ -159,7 +174,7 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+        okay &= transport_put(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -175,28 +190,51 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+static uint32_t     slave_matrix_last_update                    = 0;
+static matrix_row_t slave_matrix_last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update                    = 0;
-    static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
-    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
+    matrix_row_t temp_matrix[(MATRIX_ROWS) / 2]; // holding area while we test whether or not checksum is correct
+
+#ifdef SERIAL_USART_MATRIX_PUSH
+    // Changes are pushed by the slave, only poll after a missed push or for the forced resync
+    if (transport_slave_matrix_pull() && timer_elapsed32(slave_matrix_last_update) < FORCED_SYNC_THROTTLE_MS) {
+        memcpy(slave_matrix_last_matrix, split_shmem->smatrix.matrix, sizeof(slave_matrix_last_matrix));
+        memcpy(slave_matrix, slave_matrix_last_matrix, sizeof(slave_matrix_last_matrix));
+        return true;
+    }
+#endif // SERIAL_USART_MATRIX_PUSH
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &slave_matrix_last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
-        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+        memcpy(slave_matrix_last_matrix, temp_matrix, sizeof(temp_matrix));
     }
     // Copy out the last-known-good matrix state to the slave matrix
-    memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+    memcpy(slave_matrix, slave_matrix_last_matrix, sizeof(slave_matrix_last_matrix));
     return okay;
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SERIAL_USART_MATRIX_PUSH
+    bool changed = memcmp(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix)) != 0;
+#endif // SERIAL_USART_MATRIX_PUSH
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#ifdef SERIAL_USART_MATRIX_PUSH
+    if (changed) {
+        transport_slave_matrix_push();
+    }
+#endif // SERIAL_USART_MATRIX_PUSH
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#ifdef SPLIT_BULK_SYNC
+// Read back along with the bulk sync, at the end of the transactions
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER()
+#else
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#endif // SPLIT_BULK_SYNC
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
@@ -299,7 +337,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= transport_put(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
             last_update = timer_read32();
         }
@@ -424,7 +462,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= transport_put(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
             last_update = timer_read32();
         }
@@ -790,7 +828,13 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 static bool watchdog_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     bool okay = true;
     if (!split_watchdog_check()) {
-        okay = transport_write(PUT_WATCHDOG, &okay, sizeof(okay));
+        okay = transport_put(PUT_WATCHDOG, &okay, sizeof(okay));
+#    ifdef SPLIT_BULK_SYNC
+        // A staged ping hasn't been sent yet, the bulk sync reports how that went
+        if (split_bulk_sync_region_get(bulk_sync_pending, PUT_WATCHDOG)) {
+            return okay;
+        }
+#    endif // SPLIT_BULK_SYNC
         split_watchdog_update(okay);
     }
     return okay;
@@ -911,6 +955,106 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Bulk sync
+
+#ifdef SPLIT_BULK_SYNC
+
+static bool bulk_sync_stage(int8_t id, const void *data, size_t length) {
+    // Anything that cannot be packed into a bulk frame still goes out on its own
+    if (!split_bulk_sync_can_stage(id)) {
+        return transport_write(id, data, length);
+    }
+
+    split_transaction_desc_t *trans  = &split_transaction_table[id];
+    void                     *buffer = split_trans_initiator2target_buffer(trans);
+    if (buffer != data) {
+        memcpy(buffer, data, MIN(length, trans->initiator2target_buffer_size));
+    }
+    split_bulk_sync_region_set(bulk_sync_pending, id);
+    return true;
+}
+
+static bool bulk_sync_any_pending(void) {
+    for (uint8_t i = 0; i < SPLIT_BULK_SYNC_REGION_BYTES; i++) {
+        if (bulk_sync_pending[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool bulk_sync_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Nothing changed, the checksum based matrix read is the cheaper exchange
+    if (!bulk_sync_any_pending()) {
+        return slave_matrix_handlers_master(master_matrix, slave_matrix);
+    }
+
+    while (bulk_sync_any_pending()) {
+        split_bulk_sync_request_t  request;
+        split_bulk_sync_response_t response;
+
+#    ifndef DISABLE_SYNC_TIMER
+        // Stamp the timer as it goes out, not when it was staged, or the slave would lag by the time in between
+        if (split_bulk_sync_region_get(bulk_sync_pending, PUT_SYNC_TIMER)) {
+            split_shmem->sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
+        }
+#    endif // DISABLE_SYNC_TIMER
+
+        split_bulk_sync_pack(&request, bulk_sync_pending);
+        bool okay = transport_execute_transaction(BULK_SYNC, &request, sizeof(request), &response, sizeof(response)) && response.ack == request.checksum;
+
+#    if defined(SPLIT_WATCHDOG_ENABLE)
+        if (split_bulk_sync_region_get(request.regions, PUT_WATCHDOG)) {
+            split_watchdog_update(okay);
+        }
+#    endif // defined(SPLIT_WATCHDOG_ENABLE)
+
+        if (!okay) {
+            return false;
+        }
+        for (uint8_t i = 0; i < SPLIT_BULK_SYNC_REGION_BYTES; i++) {
+            bulk_sync_pending[i] &= ~request.regions[i];
+        }
+
+        if (response.smatrix.checksum != crc8(response.smatrix.matrix, sizeof(response.smatrix.matrix))) {
+            return false;
+        }
+        memcpy(&split_shmem->smatrix, &response.smatrix, sizeof(response.smatrix));
+        memcpy(slave_matrix_last_matrix, response.smatrix.matrix, sizeof(slave_matrix_last_matrix));
+        slave_matrix_last_update = timer_read32();
+    }
+
+    memcpy(slave_matrix, slave_matrix_last_matrix, sizeof(slave_matrix_last_matrix));
+    return true;
+}
+
+static void bulk_sync_handlers_slave_unpack(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_bulk_sync_request_t  *request  = &split_shmem->bulk_sync.request;
+    split_bulk_sync_response_t *response = &split_shmem->bulk_sync.response;
+
+    // Each region is handed over as if it had arrived in its own transaction. None of them have a slave callback.
+    memcpy(&response->smatrix, &split_shmem->smatrix, sizeof(response->smatrix));
+    response->ack = split_bulk_sync_unpack(request) ? request->checksum : ~request->checksum;
+}
+
+// clang-format off
+#    define TRANSACTIONS_BULK_SYNC_MASTER() TRANSACTION_HANDLER_MASTER(bulk_sync)
+#    define TRANSACTIONS_BULK_SYNC_REGISTRATIONS \
+    [BULK_SYNC] = { \
+        sizeof_member(split_shared_memory_t, bulk_sync.request), offsetof(split_shared_memory_t, bulk_sync.request), \
+        sizeof_member(split_shared_memory_t, bulk_sync.response), offsetof(split_shared_memory_t, bulk_sync.response), \
+        bulk_sync_handlers_slave_unpack \
+    },
+// clang-format on
+
+#else // SPLIT_BULK_SYNC
+
+#    define TRANSACTIONS_BULK_SYNC_MASTER()
+#    define TRANSACTIONS_BULK_SYNC_REGISTRATIONS
+
+#endif // SPLIT_BULK_SYNC
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -941,6 +1085,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BULK_SYNC_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -971,6 +1116,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_BULK_SYNC_MASTER();
     return true;
 }
 
@@ -25,6 +25,10 @@
 
 #ifdef USE_I2C
 
+#    ifdef SERIAL_USART_MATRIX_PUSH
+#        error "SERIAL_USART_MATRIX_PUSH is not supported by the I2C transport"
+#    endif
+
 #    ifndef SLAVE_I2C_TIMEOUT
 #        define SLAVE_I2C_TIMEOUT 100
 #    endif // SLAVE_I2C_TIMEOUT
@@ -120,6 +124,16 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     return true;
 }
 
+#    ifdef SERIAL_USART_MATRIX_PUSH
+bool transport_slave_matrix_push(void) {
+    return soft_serial_matrix_push();
+}
+
+bool transport_slave_matrix_pull(void) {
+    return soft_serial_matrix_pull();
+}
+#    endif // SERIAL_USART_MATRIX_PUSH
+
 #endif // USE_I2C
 
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -31,6 +31,10 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_BULK_SYNC_PAYLOAD_SIZE
+#    define SPLIT_BULK_SYNC_PAYLOAD_SIZE 64
+#endif // SPLIT_BULK_SYNC_PAYLOAD_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -40,6 +44,13 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SERIAL_USART_MATRIX_PUSH
+// slave sends its matrix as soon as it changes
+bool transport_slave_matrix_push(void);
+// returns false if a pushed matrix was missed and it has to be read again
+bool transport_slave_matrix_pull(void);
+#endif // SERIAL_USART_MATRIX_PUSH
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -57,6 +68,30 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_BULK_SYNC
+#    include "transaction_id_define.h"
+
+// Bitmap of transaction IDs, one bit per transaction
+#    define SPLIT_BULK_SYNC_REGION_BYTES ((NUM_TOTAL_TRANSACTIONS + 7) / 8)
+
+typedef struct _split_bulk_sync_request_t {
+    uint8_t regions[SPLIT_BULK_SYNC_REGION_BYTES]; // transaction IDs whose data is packed into the payload, in ascending order
+    uint8_t length;                                // number of payload bytes in use
+    uint8_t payload[SPLIT_BULK_SYNC_PAYLOAD_SIZE];
+    uint8_t checksum; // crc8 of the fields above, up to the end of the used payload
+} split_bulk_sync_request_t;
+
+typedef struct _split_bulk_sync_response_t {
+    uint8_t                   ack; // checksum of the request, if it was applied
+    split_slave_matrix_sync_t smatrix;
+} split_bulk_sync_response_t;
+
+typedef struct _split_bulk_sync_t {
+    split_bulk_sync_request_t  request;
+    split_bulk_sync_response_t response;
+} split_bulk_sync_t;
+#endif // SPLIT_BULK_SYNC
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -154,6 +189,10 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_BULK_SYNC
+    split_bulk_sync_t bulk_sync;
+#endif // SPLIT_BULK_SYNC
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -37,6 +37,10 @@
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 #include "nvm_via.h"
 
+#ifdef PROFILING_ENABLE
+#    include "profiling.h"
+#endif
+
 #if defined(SECURE_ENABLE)
 #    include "secure.h"
 #endif
@@ -297,6 +301,12 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
         return;
     }
 
+#ifdef PROFILING_ENABLE
+    if (profiling_raw_hid_receive(data, length)) {
+        return;
+    }
+#endif
+
     switch (*command_id) {
         case id_get_protocol_version: {
             command_data[0] = VIA_PROTOCOL_VERSION >> 8;
@@ -456,6 +466,16 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             dynamic_keymap_set_buffer(offset, size, &command_data[3]);
             break;
         }
+        case id_dynamic_keymap_stream_buffer: {
+            uint16_t offset = (command_data[0] << 8) | command_data[1];
+            uint16_t size   = command_data[2]; // size <= 28
+            dynamic_keymap_stream_buffer(offset, size, &command_data[3]);
+            break;
+        }
+        case id_dynamic_keymap_stream_commit: {
+            dynamic_keymap_stream_commit();
+            break;
+        }
 #ifdef ENCODER_MAP_ENABLE
         case id_dynamic_keymap_get_encoder: {
             uint16_t keycode = dynamic_keymap_get_encoder(command_data[0], command_data[1], command_data[2] != 0);
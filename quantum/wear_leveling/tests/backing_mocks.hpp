@@ -91,11 +91,12 @@ class MockBackingStore {
     std::vector<MockBackingStoreLogEntry> write_log;
 
     // The number of times each API was invoked
-    std::uint64_t backing_init_invoke_count;
-    std::uint64_t backing_unlock_invoke_count;
-    std::uint64_t backing_erase_invoke_count;
-    std::uint64_t backing_write_invoke_count;
-    std::uint64_t backing_lock_invoke_count;
+    std::uint64_t         backing_init_invoke_count;
+    std::uint64_t         backing_unlock_invoke_count;
+    std::uint64_t         backing_erase_invoke_count;
+    std::uint64_t         backing_write_invoke_count;
+    std::uint64_t         backing_lock_invoke_count;
+    mutable std::uint64_t backing_read_invoke_count;
 
     // Whether init should succeed
     std::function<bool(std::uint64_t)> init_success_callback;
@@ -147,6 +148,9 @@ class MockBackingStore {
     std::uint64_t lock_invoke_count() const {
         return backing_lock_invoke_count;
     }
+    std::uint64_t read_invoke_count() const {
+        return backing_read_invoke_count;
+    }
 
     // Clear out the internal data for the next run
     void reset_instance();
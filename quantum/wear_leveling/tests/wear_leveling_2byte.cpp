@@ -41,6 +41,40 @@ TEST_F(WearLeveling2Byte, FirstWriteOccursAfterHash_AfterErase) {
     EXPECT_EQ((inst.log_begin() + 1)->address, WEAR_LEVELING_LOGICAL_SIZE + 8) << "Invalid first write address.";
 }
 
+/**
+ * This test ensures runs of a repeated byte or word are written as a single run-length log entry each, and played back.
+ */
+TEST_F(WearLeveling2Byte, RunLengthBackingStoreWriteCounts) {
+    auto& inst = MockBackingStore::Instance();
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    // Generate a test block of data: a repeated byte, then a repeated word
+    std::array<std::uint8_t, 12> testvalue;
+    std::fill(testvalue.begin(), testvalue.begin() + 6, 0x5A);
+    for (std::size_t i = 6; i < testvalue.size(); i += 2) {
+        testvalue[i + 0] = 0x01;
+        testvalue[i + 1] = 0x00;
+    }
+
+    // Write the data
+    EXPECT_EQ(test_write(0x02, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
+
+    // Check that we got a run-length log entry for each run
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 2 * 3);
+    for (std::size_t index = 0; index < 2 * 3; index += 3) {
+        write_log_entry_t e;
+        e.raw16[0] = (inst.log_begin() + index)->value;
+        EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_RUN) << "Invalid write log entry type";
+        EXPECT_EQ(LOG_ENTRY_RUN_GET_WIDTH(e), index == 0 ? 1 : 2) << "Invalid write log entry width";
+    }
+
+    // Re-init and re-read, testing the reload capability
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
+
 /**
  * This test forces consolidation by writing enough to the write log that it overflows, consolidating the data into the
  * base logical area.
@@ -226,3 +260,45 @@ TEST_F(WearLeveling2Byte, PlaybackReadbackWord01_OOB) {
     wear_leveling_read(0x02, &tmp, sizeof(tmp));
     EXPECT_EQ(tmp, 1) << "Readback should have maintained the previous pre-failure value from the write log";
 }
+
+/**
+ * This test verifies run-length readback gets canceled with an out-of-bounds address.
+ */
+TEST_F(WearLeveling2Byte, PlaybackReadbackRun_OOB) {
+    auto& inst     = MockBackingStore::Instance();
+    auto  logstart = inst.storage_begin() + (WEAR_LEVELING_LOGICAL_SIZE / sizeof(backing_store_int_t));
+
+    // Invalid FNV1a_64 hash
+    (logstart + 0)->set(0);
+    (logstart + 1)->set(0);
+    (logstart + 2)->set(0);
+    (logstart + 3)->set(0);
+
+    // Set up a run of 6 bytes of 0x11 at logical offset 0x01
+    auto entry0 = LOG_ENTRY_MAKE_RUN(0x01, 1, 6, 0x11, 0);
+    (logstart + 4)->set(~entry0.raw16[0]);
+    (logstart + 5)->set(~entry0.raw16[1]);
+    (logstart + 6)->set(~entry0.raw16[2]);
+
+    // Set up a run of 4 words of [0x13,0x14] at logical offset 0x0C (out of bounds)
+    auto entry1 = LOG_ENTRY_MAKE_RUN(0x0C, 2, 4, 0x13, 0x14);
+    (logstart + 7)->set(~entry1.raw16[0]);
+    (logstart + 8)->set(~entry1.raw16[1]);
+    (logstart + 9)->set(~entry1.raw16[2]);
+
+    // Set up a run of 6 bytes of 0x15 at logical offset 0x01
+    auto entry2 = LOG_ENTRY_MAKE_RUN(0x01, 1, 6, 0x15, 0);
+    (logstart + 10)->set(~entry2.raw16[0]);
+    (logstart + 11)->set(~entry2.raw16[1]);
+    (logstart + 12)->set(~entry2.raw16[2]);
+
+    EXPECT_EQ(inst.erasure_count(), 0) << "Invalid initial erase count";
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_CONSOLIDATED) << "Readback should have failed and triggered consolidation";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Invalid final erase count";
+
+    uint8_t buf[6];
+    wear_leveling_read(0x01, buf, sizeof(buf));
+    for (std::size_t i = 0; i < sizeof(buf); ++i) {
+        EXPECT_EQ(buf[i], 0x11) << "Readback should have maintained the previous pre-failure value from the write log";
+    }
+}
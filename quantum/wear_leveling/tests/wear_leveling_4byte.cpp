@@ -72,6 +72,40 @@ TEST_F(WearLeveling4Byte, MultibyteBackingStoreWriteCounts) {
     }
 }
 
+/**
+ * This test ensures runs of a repeated byte or word are written as a single run-length log entry each, and played back.
+ */
+TEST_F(WearLeveling4Byte, RunLengthBackingStoreWriteCounts) {
+    auto& inst = MockBackingStore::Instance();
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    // Generate a test block of data: a repeated byte, then a repeated word
+    std::array<std::uint8_t, 12> testvalue;
+    std::fill(testvalue.begin(), testvalue.begin() + 6, 0x5A);
+    for (std::size_t i = 6; i < testvalue.size(); i += 2) {
+        testvalue[i + 0] = 0x01;
+        testvalue[i + 1] = 0x00;
+    }
+
+    // Write the data
+    EXPECT_EQ(test_write(0x02, testvalue.data(), testvalue.size()), WEAR_LEVELING_SUCCESS) << "Write failed with incorrect status";
+
+    // Check that we got a run-length log entry for each run
+    EXPECT_EQ(std::distance(inst.log_begin(), inst.log_end()), 2 * 2);
+    for (std::size_t index = 0; index < 2 * 2; index += 2) {
+        write_log_entry_t e;
+        e.raw32[0] = (inst.log_begin() + index)->value;
+        EXPECT_EQ(LOG_ENTRY_GET_TYPE(e), LOG_ENTRY_TYPE_RUN) << "Invalid write log entry type";
+        EXPECT_EQ(LOG_ENTRY_RUN_GET_WIDTH(e), index == 0 ? 1 : 2) << "Invalid write log entry width";
+    }
+
+    // Re-init and re-read, testing the reload capability
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
+
 /**
  * This test forces consolidation by writing enough to the write log that it overflows, consolidating the data into the
  * base logical area.
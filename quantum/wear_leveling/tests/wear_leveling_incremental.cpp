@@ -0,0 +1,215 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+static std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+class WearLevelingIncremental : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+};
+
+static wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+    memcpy(&verify_data[address], value, length);
+    return wear_leveling_write(address, value, length);
+}
+
+// Each single byte write is one backing store write, so this fills the write log past the threshold without overflowing it
+static void fill_past_threshold(void) {
+    const std::size_t log_size = WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8;
+    const std::size_t count    = (log_size * WEAR_LEVELING_CONSOLIDATION_THRESHOLD / 100) / BACKING_STORE_WRITE_SIZE + 1;
+    for (std::size_t i = 0; i < count; ++i) {
+        uint8_t value = (uint8_t)(i + 1);
+        EXPECT_EQ(test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    }
+}
+
+static void expect_readback_after_init(void) {
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_NE(wear_leveling_init(), WEAR_LEVELING_FAILED) << "Re-initialisation failed";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), WEAR_LEVELING_LOGICAL_SIZE), WEAR_LEVELING_SUCCESS) << "Failed to read back the saved data";
+    EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), WEAR_LEVELING_LOGICAL_SIZE) == 0) << "Readback did not match";
+}
+
+/**
+ * This test verifies that the task does nothing while the write log is below the threshold.
+ */
+TEST_F(WearLevelingIncremental, BelowThreshold_NoConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint8_t test_value = 0x15;
+    EXPECT_EQ(test_write(0x02, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    uint64_t write_count = inst.write_invoke_count();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Invalid erase count";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Invalid write count";
+    EXPECT_EQ(inst.unlock_invoke_count(), inst.lock_invoke_count()) << "Backing store was left unlocked";
+}
+
+/**
+ * This test verifies that consolidation is spread over one erase and one chunk of the consolidated area per task call.
+ */
+TEST_F(WearLevelingIncremental, PastThreshold_ConsolidatesInChunks) {
+    auto& inst = MockBackingStore::Instance();
+    fill_past_threshold();
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Consolidation should not have occurred during writes";
+
+    // First call erases
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Invalid erase count";
+
+    // Following calls write a chunk each, the last one followed by the checksum
+    const std::size_t chunks = WEAR_LEVELING_LOGICAL_SIZE / WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE;
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+        uint64_t               write_count = inst.write_invoke_count();
+        wear_leveling_status_t status      = wear_leveling_task();
+        std::size_t            expected    = WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE / BACKING_STORE_WRITE_SIZE;
+        if (chunk == chunks - 1) {
+            EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Last chunk should complete consolidation";
+            expected += 8 / BACKING_STORE_WRITE_SIZE;
+        } else {
+            EXPECT_EQ(status, WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+        }
+        EXPECT_EQ(inst.write_invoke_count() - write_count, expected) << "Invalid write count for chunk " << chunk;
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 1) << "Invalid erase count";
+    EXPECT_EQ(inst.unlock_invoke_count(), inst.lock_invoke_count()) << "Backing store was left unlocked";
+
+    // The write log is empty again, so nothing else happens
+    uint64_t write_count = inst.write_invoke_count();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Invalid write count";
+
+    expect_readback_after_init();
+}
+
+/**
+ * This test verifies that writes made while consolidating, before and after their chunk is written, survive a reload.
+ */
+TEST_F(WearLevelingIncremental, WritesDuringConsolidation) {
+    fill_past_threshold();
+
+    // Erase, then write the first chunk
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+
+    // One write to the chunk already written, one to a chunk still to be written
+    uint8_t test_value = 0xA5;
+    EXPECT_EQ(test_write(0x00, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ(test_write(WEAR_LEVELING_LOGICAL_SIZE - 1, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_task();
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Task returned incorrect status";
+
+    expect_readback_after_init();
+}
+
+/**
+ * This test verifies that filling the write log while consolidating falls back to an in-line consolidation.
+ */
+TEST_F(WearLevelingIncremental, LogOverflowDuringConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+    fill_past_threshold();
+
+    // Erase, then write the first chunk
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+
+    // Overflow the write log
+    wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
+    for (std::size_t i = 0; status == WEAR_LEVELING_SUCCESS; ++i) {
+        uint8_t value = (uint8_t)(0x80 + i);
+        status        = test_write(i % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+    }
+    EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    EXPECT_EQ(inst.erase_invoke_count(), 2) << "Invalid erase count";
+
+    // The in-line consolidation supersedes the incremental one
+    uint64_t write_count = inst.write_invoke_count();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Invalid write count";
+
+    expect_readback_after_init();
+}
+
+/**
+ * This test verifies that an erase abandons an incremental consolidation.
+ */
+TEST_F(WearLevelingIncremental, EraseDuringConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+    fill_past_threshold();
+
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(wear_leveling_erase(), WEAR_LEVELING_SUCCESS) << "Erase returned incorrect status";
+    std::fill(verify_data.begin(), verify_data.end(), 0);
+
+    uint64_t write_count = inst.write_invoke_count();
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Invalid write count";
+
+    expect_readback_after_init();
+}
+
+/**
+ * This test verifies that a run of repeated values, such as a layer cleared to KC_TRNS, takes up far less of the write
+ * log than multi-byte entries would.
+ */
+TEST_F(WearLevelingIncremental, RunLengthEntriesShrinkLog) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<uint16_t, WEAR_LEVELING_LOGICAL_SIZE / sizeof(uint16_t)> layer;
+    std::fill(layer.begin(), layer.end(), 0x0001); // KC_TRANSPARENT
+    uint64_t write_count = inst.total_write_count();
+    EXPECT_EQ(test_write(0, layer.data(), sizeof(layer)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+
+    // A multi-byte entry holds up to 5 bytes in 8 bytes of the log
+    std::size_t multibyte_writes = (sizeof(layer) + LOG_ENTRY_MULTIBYTE_MAX_BYTES - 1) / LOG_ENTRY_MULTIBYTE_MAX_BYTES * 8 / BACKING_STORE_WRITE_SIZE;
+    EXPECT_LT(inst.total_write_count() - write_count, multibyte_writes / 4) << "Run-length entries should shrink the log";
+
+    expect_readback_after_init();
+}
+
+/**
+ * This test verifies that running the task between writes splits up the burst of backing store writes that consolidating
+ * in-line makes once the write log fills.
+ */
+TEST_F(WearLevelingIncremental, TaskSplitsUpLargestBurst) {
+    auto& inst = MockBackingStore::Instance();
+
+    auto run = [&](bool task) {
+        inst.reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+
+        std::size_t max_burst = 0;
+        for (int i = 0; i < 1000; ++i) {
+            uint8_t  value  = (uint8_t)(i * 7 + 1);
+            uint64_t before = inst.write_invoke_count();
+            EXPECT_NE(test_write((i * 13) % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value)), WEAR_LEVELING_FAILED) << "Write failed";
+            if (task) {
+                EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task failed";
+            }
+            max_burst = std::max<std::size_t>(max_burst, inst.write_invoke_count() - before);
+        }
+        EXPECT_GT(inst.erase_invoke_count(), 0) << "The write log should have been consolidated";
+        expect_readback_after_init();
+        return max_burst;
+    };
+
+    std::size_t blocking    = run(false);
+    std::size_t incremental = run(true);
+    EXPECT_LT(incremental, blocking) << "Incremental consolidation should split up the largest burst of writes";
+}
@@ -62,6 +62,12 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_INCREMENTAL_CONSOLIDATION: When defined, consolidation
+            is started early by wear_leveling_task() once the write log is
+            WEAR_LEVELING_CONSOLIDATION_THRESHOLD percent full, and the
+            consolidated data is written WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE
+            bytes per call instead of in one go.
+
     General algorithm:
 
         During initialization:
@@ -77,6 +83,17 @@
             * A new write log entry is appended to the log.
             * If the log's full, data is consolidated and the write log cleared.
 
+        During incremental consolidation (wear_leveling_task()):
+            * Once the log passes the threshold, the backing store is erased and
+                the write log starts again, empty.
+            * Each subsequent call writes the next chunk of the cache to the
+                consolidated data section, hashing it as it goes.
+            * Writes made in the meantime are appended to the new write log as
+                usual, so chunks already written are corrected on playback.
+            * Once every chunk is written, the hash is written after them.
+            * If the log fills up before that, a full consolidation happens
+                in-line as usual.
+
     Write log structure:
 
         The first 8 bytes of the write log are a FNV1a_64 hash of the contents
@@ -115,6 +132,20 @@
         19 bits are used for the address, which allows for a max logical size of
         512kB. Up to 5 bytes can be included in a single log entry.
 
+        For runs of more than 5 repeated bytes or 16-bit words, such as a
+        cleared keymap layer or macro buffer, a run-length log entry is used:
+
+        ╔ Run-length Log Entry (2, 4, 8-byte) ════════════════╗
+        ║11W00YYY║YYYYYYYY║YYYYYYYY║CCCCCCCC║AAAAAAAA║BBBBBBBB║
+        ║  │  └┬┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║└──┬───┘║
+        ║  W  Add║ Address║ Address║ Count-1║Value[0]║Value[1]║
+        ╚════════╩════════╩════════╩════════╩════════╩════════╝
+
+        Value[0] is repeated Count times when Width is 0, or Value[0], Value[1]
+        is repeated Count times when Width is 1 -- up to 256 bytes or 512 bytes
+        respectively. This needs 3, 2, or 1 backing store write operations for
+        2-, 4-, and 8-byte backing store writes.
+
         For 2-byte backing store writes, the last two bytes are optional
             depending on the length of data to be written. Accordingly, either 3
             or 4 backing store write operations will occur.
@@ -163,6 +194,11 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    bool                                                           consolidating;       // the backing store has been erased, and the cache is being written back
+    uint32_t                                                       consolidate_address; // next logical address to write to the consolidated area
+    uint64_t                                                       consolidate_hash;    // FNV1a_64 of the consolidated area written so far
+#endif
 } wear_leveling;
 
 /**
@@ -204,6 +240,9 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    wear_leveling.consolidating = false;
+#endif
 }
 
 /**
@@ -249,6 +288,22 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     return status;
 }
 
+/**
+ * Writes the FNV1a_64 of the consolidated data, directly after it.
+ */
+static bool wear_leveling_write_checksum(uint64_t hash) {
+    write_log_entry_t entry;
+    entry.raw64 = hash;
+    wl_dprintf("Writing checksum\n");
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64);
+#endif
+}
+
 /**
  * Writes the current cache to consolidated data at the beginning of the backing store.
  * Does not clear the write log.
@@ -266,27 +321,9 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
-        write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_checksum(fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT))) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -303,6 +340,11 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     wl_dprintf("Erasing backing store\n");
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    // Supersedes any incremental consolidation in progress
+    wear_leveling.consolidating = false;
+#endif
+
     // Erase the backing store. Expectation is that any un-written values that are read back after this call come back as zero.
     bool ok = backing_store_erase();
     if (!ok) {
@@ -337,6 +379,54 @@ static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
     return WEAR_LEVELING_SUCCESS;
 }
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+/**
+ * Performs the next step of an incremental consolidation: either the erase, or writing the next chunk of the cache and,
+ * after the last one, the checksum.
+ * During this operation, there is the potential for data loss if a power loss occurs.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED once the checksum has been written
+ */
+static wear_leveling_status_t wear_leveling_consolidate_step(void) {
+    if (!wear_leveling.consolidating) {
+        wl_dprintf("Starting incremental consolidation, erasing backing store\n");
+        if (!backing_store_erase()) {
+            wl_dprintf("Failed to erase backing store\n");
+            return WEAR_LEVELING_FAILED;
+        }
+
+        // Writes made from here on are logged after the (yet to be written) consolidated area, and are played back over it
+        wear_leveling.write_address       = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+        wear_leveling.consolidating       = true;
+        wear_leveling.consolidate_address = 0;
+        wear_leveling.consolidate_hash    = FNV1A_64_INIT;
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    const uint32_t address   = wear_leveling.consolidate_address;
+    const uint32_t remaining = (WEAR_LEVELING_LOGICAL_SIZE) - address;
+    const uint32_t length    = remaining < (WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE) ? remaining : (WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE);
+    wl_dprintf("Writing consolidated data [0x%04X]\n", (int)address);
+    if (!backing_store_write_bulk(address, (backing_store_int_t *)&wear_leveling.cache[address], length / sizeof(backing_store_int_t))) {
+        // What has been written can't be rewritten without another erase
+        wl_dprintf("Failed to write to backing store\n");
+        return wear_leveling_consolidate_force();
+    }
+    wear_leveling.consolidate_hash = fnv_64a_buf(&wear_leveling.cache[address], length, wear_leveling.consolidate_hash);
+    wear_leveling.consolidate_address += length;
+    if (wear_leveling.consolidate_address < (WEAR_LEVELING_LOGICAL_SIZE)) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    wear_leveling.consolidating = false;
+    if (!wear_leveling_write_checksum(wear_leveling.consolidate_hash)) {
+        wl_dprintf("Failed to write checksum\n");
+        return wear_leveling_consolidate_force();
+    }
+    return WEAR_LEVELING_CONSOLIDATED;
+}
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 /**
  * Appends the supplied fixed-width entry to the write log, optionally consolidating if the log is full.
  *
@@ -411,6 +501,66 @@ static wear_leveling_status_t wear_leveling_write_raw_multibyte(uint32_t address
     return status;
 }
 
+/**
+ * Handles writing run-length-encoded data to the backing store.
+ *
+ * @return true if consolidation occurred
+ */
+static wear_leveling_status_t wear_leveling_write_raw_run(uint32_t address, uint8_t width, size_t count, const uint8_t *p) {
+    write_log_entry_t log = LOG_ENTRY_MAKE_RUN(address, width, count, p[0], width > 1 ? p[1] : 0);
+
+    // Write to the backing store. See the run-length log format in the documentation header at the top of the file.
+    wear_leveling_status_t status;
+#if BACKING_STORE_WRITE_SIZE == 2
+    for (int i = 0; i < 3; ++i) {
+        status = wear_leveling_append_raw(log.raw16[i]);
+        if (status != WEAR_LEVELING_SUCCESS) {
+            return status;
+        }
+    }
+#elif BACKING_STORE_WRITE_SIZE == 4
+    status = wear_leveling_append_raw(log.raw32[0]);
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+
+    status = wear_leveling_append_raw(log.raw32[1]);
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+#elif BACKING_STORE_WRITE_SIZE == 8
+    status = wear_leveling_append_raw(log.raw64);
+    if (status != WEAR_LEVELING_SUCCESS) {
+        return status;
+    }
+#endif
+    return status;
+}
+
+/**
+ * Finds the longest run of a repeated byte or 16-bit word at the start of the supplied data.
+ *
+ * @return the length of the run in bytes, with the width of the repeated value in `width`
+ */
+static size_t wear_leveling_run_length(const uint8_t *p, size_t length, uint8_t *width) {
+    size_t bytes = 1;
+    while (bytes < length && bytes < LOG_ENTRY_RUN_MAX_COUNT && p[bytes] == p[0]) {
+        ++bytes;
+    }
+
+    size_t words = 2;
+    while (words + 1 < length && words < LOG_ENTRY_RUN_MAX_COUNT * 2 && p[words] == p[0] && p[words + 1] == p[1]) {
+        words += 2;
+    }
+
+    if (length >= 2 && words > bytes) {
+        *width = 2;
+        return words;
+    }
+    *width = 1;
+    return bytes;
+}
+
 /**
  * Handles the actual writing of logical data into the write log section of the backing store.
  */
@@ -419,6 +569,23 @@ static wear_leveling_status_t wear_leveling_write_raw(uint32_t address, const vo
     size_t                 remaining = length;
     wear_leveling_status_t status    = WEAR_LEVELING_SUCCESS;
     while (remaining > 0) {
+        // Runs of a repeated byte or word, longer than a multi-byte entry can hold:
+        uint8_t      run_width;
+        const size_t run_length = wear_leveling_run_length(p, remaining, &run_width);
+        if (run_length > LOG_ENTRY_MULTIBYTE_MAX_BYTES) {
+            status = wear_leveling_write_raw_run(address, run_width, run_length / run_width, p);
+            if (status != WEAR_LEVELING_SUCCESS) {
+                // If consolidation occurred, then the cache has already been written to the consolidated area. No need to continue.
+                // If a failure occurred, pass it on.
+                return status;
+            }
+
+            remaining -= run_length;
+            address += (uint32_t)run_length;
+            p += run_length;
+            continue;
+        }
+
 #if BACKING_STORE_WRITE_SIZE == 2
         // Small-write optimizations - uint16_t, 0 or 1, address is even, address <16384:
         if (remaining >= 2 && address % 2 == 0 && address < 16384) {
@@ -478,7 +645,7 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8;           // +8 due to the FNV1a_64 of the consolidated area
     while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
         backing_store_int_t value;
         bool                ok = backing_store_read(address, &value);
@@ -591,6 +758,45 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
                 wear_leveling.cache[a + 1] = 0;
             } break;
 #endif // BACKING_STORE_WRITE_SIZE == 2
+            case LOG_ENTRY_TYPE_RUN: {
+#if BACKING_STORE_WRITE_SIZE == 2
+                ok = backing_store_read(address, &log.raw16[1]) && backing_store_read(address + (BACKING_STORE_WRITE_SIZE), &log.raw16[2]);
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+                address += 2 * (BACKING_STORE_WRITE_SIZE);
+#elif BACKING_STORE_WRITE_SIZE == 4
+                ok = backing_store_read(address, &log.raw32[1]);
+                if (!ok) {
+                    wl_dprintf("Failed to load from backing store, skipping playback of write log\n");
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+                address += (BACKING_STORE_WRITE_SIZE);
+#endif
+                const uint32_t a = LOG_ENTRY_RUN_GET_ADDRESS(log);
+                const uint8_t  w = LOG_ENTRY_RUN_GET_WIDTH(log);
+                const uint32_t l = LOG_ENTRY_RUN_GET_COUNT(log) * w;
+
+                if (a + l > (WEAR_LEVELING_LOGICAL_SIZE)) {
+                    cancel_playback = true;
+                    status          = WEAR_LEVELING_FAILED;
+                    break;
+                }
+
+                if (w == 1) {
+                    memset(&wear_leveling.cache[a], log.raw8[4], l);
+                } else {
+                    for (uint32_t i = 0; i < l; i += 2) {
+                        wear_leveling.cache[a + i + 0] = log.raw8[4];
+                        wear_leveling.cache[a + i + 1] = log.raw8[5];
+                    }
+                }
+            } break;
             default: {
                 cancel_playback = true;
                 status          = WEAR_LEVELING_FAILED;
@@ -727,6 +933,38 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+/**
+ * Advances any incremental consolidation by one step, starting one once the write log passes the threshold.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+    const uint32_t log_start = (WEAR_LEVELING_LOGICAL_SIZE) + 8;                         // +8 due to the FNV1a_64 of the consolidated area
+    const uint32_t threshold = ((WEAR_LEVELING_BACKING_SIZE) - log_start) * (WEAR_LEVELING_CONSOLIDATION_THRESHOLD) / 100;
+    if (!wear_leveling.consolidating && wear_leveling.write_address - log_start < threshold) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidate_step();
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+#else
+    return WEAR_LEVELING_SUCCESS;
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+}
+
 /**
  * Reads logical data from the cache.
  */
@@ -52,3 +52,14 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Periodic task, to be called from the main loop.
+ *
+ * With WEAR_LEVELING_INCREMENTAL_CONSOLIDATION defined, consolidation is started once the write log passes
+ * WEAR_LEVELING_CONSOLIDATION_THRESHOLD percent full, and carried out one erase or one chunk of the consolidated area per
+ * call. Otherwise this does nothing.
+ *
+ * @return Status of the request, WEAR_LEVELING_CONSOLIDATED once a consolidation has completed
+ */
+wear_leveling_status_t wear_leveling_task(void);
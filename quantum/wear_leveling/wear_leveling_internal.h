@@ -64,6 +64,17 @@ STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "T
 STATIC_ASSERT(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 STATIC_ASSERT(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#ifdef WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+#    ifndef WEAR_LEVELING_CONSOLIDATION_THRESHOLD
+#        define WEAR_LEVELING_CONSOLIDATION_THRESHOLD 75
+#    endif
+#    ifndef WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE
+#        define WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE 64
+#    endif
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_THRESHOLD > 0 && WEAR_LEVELING_CONSOLIDATION_THRESHOLD < 100, "Consolidation threshold must be a percentage of the write log, between 1 and 99");
+STATIC_ASSERT(WEAR_LEVELING_CONSOLIDATION_CHUNK_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation chunk size must be a multiple of write size");
+#endif // WEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
@@ -99,6 +110,9 @@ enum {
     // 0x02 -- 2-byte backing store write optimization: word-encoded 0/1 values
     LOG_ENTRY_TYPE_WORD_01,
 
+    // 0x03 -- Run-length storage type: a byte or word repeated
+    LOG_ENTRY_TYPE_RUN,
+
     LOG_ENTRY_TYPES
 };
 
@@ -147,3 +161,22 @@ STATIC_ASSERT(LOG_ENTRY_TYPES <= (1 << 2), "Too many log entry types to fit into
             [1] = (uint8_t)((address) >> 1), /* address */                                            \
         }                                                                                             \
     }
+
+#define LOG_ENTRY_RUN_MAX_COUNT 256
+#define LOG_ENTRY_RUN_GET_ADDRESS(entry) LOG_ENTRY_MULTIBYTE_GET_ADDRESS(entry)
+#define LOG_ENTRY_RUN_GET_WIDTH(entry) ((uint8_t)((((entry).raw8[0] >> 5) & BITMASK_FOR_BITCOUNT(1)) + 1))
+#define LOG_ENTRY_RUN_GET_COUNT(entry) (((uint32_t)((entry).raw8[3])) + 1)
+#define LOG_ENTRY_MAKE_RUN(address, width, count, value0, value1)                                      \
+    (write_log_entry_t) {                                                                              \
+        .raw8 = {                                                                                      \
+            [0] = (((((uint8_t)LOG_ENTRY_TYPE_RUN) & BITMASK_FOR_BITCOUNT(2)) << 6)      /* type */    \
+                   | (((((uint8_t)((width) - 1))) & BITMASK_FOR_BITCOUNT(1)) << 5)       /* width */   \
+                   | ((((uint8_t)((address) >> 16))) & BITMASK_FOR_BITCOUNT(3))          /* address */ \
+                   ),                                                                                  \
+            [1] = (((uint8_t)((address) >> 8)) & BITMASK_FOR_BITCOUNT(8)), /* address */               \
+            [2] = (((uint8_t)(address)) & BITMASK_FOR_BITCOUNT(8)),        /* address */               \
+            [3] = ((uint8_t)((count) - 1)),                                /* count */                 \
+            [4] = ((uint8_t)(value0)),                                     /* value */                 \
+            [5] = ((uint8_t)(value1)),                                     /* value */                 \
+        }                                                                                              \
+    }
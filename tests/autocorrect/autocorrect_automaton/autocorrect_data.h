@@ -0,0 +1,212 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+
+// Autocorrection dictionary (70 entries):
+//   :guage     -> gauge
+//   :the:the:  -> the
+//   :thier     -> their
+//   :ture      -> true
+//   accomodate -> accommodate
+//   acommodate -> accommodate
+//   aparent    -> apparent
+//   aparrent   -> apparent
+//   apparant   -> apparent
+//   apparrent  -> apparent
+//   aquire     -> acquire
+//   becuase    -> because
+//   cauhgt     -> caught
+//   cheif      -> chief
+//   choosen    -> chosen
+//   cieling    -> ceiling
+//   collegue   -> colleague
+//   concensus  -> consensus
+//   contians   -> contains
+//   cosnt      -> const
+//   dervied    -> derived
+//   fales      -> false
+//   fasle      -> false
+//   fitler     -> filter
+//   flase      -> false
+//   foward     -> forward
+//   frequecy   -> frequency
+//   gaurantee  -> guarantee
+//   guaratee   -> guarantee
+//   heigth     -> height
+//   heirarchy  -> hierarchy
+//   inclued    -> include
+//   interator  -> iterator
+//   intput     -> input
+//   invliad    -> invalid
+//   lenght     -> length
+//   liasion    -> liaison
+//   libary     -> library
+//   listner    -> listener
+//   looses:    -> loses
+//   looup      -> lookup
+//   manefist   -> manifest
+//   namesapce  -> namespace
+//   namespcae  -> namespace
+//   occassion  -> occasion
+//   occured    -> occurred
+//   ouptut     -> output
+//   ouput      -> output
+//   overide    -> override
+//   postion    -> position
+//   priviledge -> privilege
+//   psuedo     -> pseudo
+//   recieve    -> receive
+//   refered    -> referred
+//   relevent   -> relevant
+//   repitition -> repetition
+//   retrun     -> return
+//   retun      -> return
+//   reuslt     -> result
+//   reutrn     -> return
+//   saftey     -> safety
+//   seperate   -> separate
+//   singed     -> signed
+//   stirng     -> string
+//   strign     -> string
+//   swithc     -> switch
+//   swtich     -> switch
+//   thresold   -> threshold
+//   udpate     -> update
+//   widht      -> width
+
+#define AUTOCORRECT_MIN_LENGTH 5 // ":ture"
+#define AUTOCORRECT_MAX_LENGTH 10 // "accomodate"
+#define DICTIONARY_SIZE 1683
+#define AUTOCORRECT_DATA_AUTOMATON
+
+static const uint8_t autocorrect_data[DICTIONARY_SIZE] PROGMEM = {
+    0x13, 0x00, 0x00, 0x04, 0x3C, 0x00, 0x05, 0xFE, 0x00, 0x06, 0x16, 0x01, 0x07, 0xD0, 0x01, 0x09,
+    0xE8, 0x01, 0x0A, 0x63, 0x02, 0x0B, 0xA3, 0x02, 0x0C, 0xD5, 0x02, 0x0F, 0x32, 0x03, 0x10, 0xAF,
+    0x03, 0x11, 0xCB, 0x03, 0x12, 0xFD, 0x03, 0x13, 0x6D, 0x04, 0x15, 0xBD, 0x04, 0x16, 0x66, 0x05,
+    0x17, 0xFE, 0x05, 0x18, 0x19, 0x06, 0x1A, 0x2F, 0x06, 0x2C, 0x3F, 0x06, 0x03, 0x00, 0x00, 0x06,
+    0x48, 0x00, 0x13, 0x8E, 0x00, 0x14, 0xEA, 0x00, 0x02, 0x16, 0x01, 0x06, 0x51, 0x00, 0x12, 0x6E,
+    0x00, 0x52, 0x16, 0x01, 0x50, 0x72, 0x01, 0x52, 0xAF, 0x03, 0x47, 0xFD, 0x03, 0x44, 0xD0, 0x01,
+    0x57, 0x3C, 0x00, 0x48, 0xFE, 0x05, 0x84, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x50, 0x72,
+    0x01, 0x50, 0xAF, 0x03, 0x52, 0xAF, 0x03, 0x47, 0xFD, 0x03, 0x44, 0xD0, 0x01, 0x57, 0x3C, 0x00,
+    0x48, 0xFE, 0x05, 0x87, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x64, 0x61, 0x74, 0x65, 0x00, 0x02, 0x6D,
+    0x04, 0x04, 0x97, 0x00, 0x13, 0xC2, 0x00, 0x55, 0x3C, 0x00, 0x02, 0xBD, 0x04, 0x08, 0xA3, 0x00,
+    0x15, 0xB1, 0x00, 0x51, 0xC0, 0x04, 0x57, 0xCB, 0x03, 0x84, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74,
+    0x00, 0x48, 0xBD, 0x04, 0x51, 0xC0, 0x04, 0x57, 0xCB, 0x03, 0x85, 0x70, 0x61, 0x72, 0x65, 0x6E,
+    0x74, 0x00, 0x44, 0x6D, 0x04, 0x55, 0x3C, 0x00, 0x02, 0xBD, 0x04, 0x04, 0xD1, 0x00, 0x15, 0xDC,
+    0x00, 0x51, 0x3C, 0x00, 0x57, 0xCB, 0x03, 0x82, 0x65, 0x6E, 0x74, 0x00, 0x48, 0xBD, 0x04, 0x51,
+    0xC0, 0x04, 0x57, 0xCB, 0x03, 0x83, 0x65, 0x6E, 0x74, 0x00, 0x58, 0x00, 0x00, 0x4C, 0x19, 0x06,
+    0x55, 0xD5, 0x02, 0x48, 0xBD, 0x04, 0x84, 0x63, 0x71, 0x75, 0x69, 0x72, 0x65, 0x00, 0x48, 0x00,
+    0x00, 0x46, 0x00, 0x00, 0x58, 0x16, 0x01, 0x44, 0x19, 0x06, 0x56, 0x3C, 0x00, 0x48, 0x66, 0x05,
+    0x83, 0x61, 0x75, 0x73, 0x65, 0x00, 0x04, 0x00, 0x00, 0x04, 0x25, 0x01, 0x0B, 0x36, 0x01, 0x0C,
+    0x5B, 0x01, 0x12, 0x72, 0x01, 0x58, 0x3C, 0x00, 0x4B, 0x19, 0x06, 0x4A, 0xA3, 0x02, 0x57, 0x63,
+    0x02, 0x82, 0x67, 0x68, 0x74, 0x00, 0x02, 0xA3, 0x02, 0x08, 0x3F, 0x01, 0x12, 0x4A, 0x01, 0x4C,
+    0xA6, 0x02, 0x49, 0xA9, 0x02, 0x82, 0x69, 0x65, 0x66, 0x00, 0x52, 0xFD, 0x03, 0x56, 0xFD, 0x03,
+    0x48, 0x66, 0x05, 0x51, 0x89, 0x05, 0x83, 0x73, 0x65, 0x6E, 0x00, 0x48, 0xD5, 0x02, 0x4F, 0x00,
+    0x00, 0x4C, 0x32, 0x03, 0x51, 0x4E, 0x03, 0x4A, 0xD8, 0x02, 0x85, 0x65, 0x69, 0x6C, 0x69, 0x6E,
+    0x67, 0x00, 0x03, 0xFD, 0x03, 0x0F, 0x7E, 0x01, 0x11, 0x93, 0x01, 0x16, 0xC5, 0x01, 0x4F, 0x32,
+    0x03, 0x48, 0x32, 0x03, 0x4A, 0x3E, 0x03, 0x58, 0x63, 0x02, 0x48, 0x8B, 0x02, 0x82, 0x61, 0x67,
+    0x75, 0x65, 0x00, 0x02, 0xCB, 0x03, 0x06, 0x9C, 0x01, 0x17, 0xB3, 0x01, 0x48, 0x16, 0x01, 0x51,
+    0x00, 0x00, 0x56, 0xCB, 0x03, 0x58, 0x66, 0x05, 0x56, 0x19, 0x06, 0x85, 0x73, 0x65, 0x6E, 0x73,
+    0x75, 0x73, 0x00, 0x4C, 0xFE, 0x05, 0x44, 0xD5, 0x02, 0x51, 0x3C, 0x00, 0x56, 0xCB, 0x03, 0x83,
+    0x61, 0x69, 0x6E, 0x73, 0x00, 0x51, 0x66, 0x05, 0x57, 0xCB, 0x03, 0x82, 0x6E, 0x73, 0x74, 0x00,
+    0x48, 0x00, 0x00, 0x55, 0x00, 0x00, 0x59, 0xBD, 0x04, 0x4C, 0x00, 0x00, 0x48, 0xD5, 0x02, 0x47,
+    0x00, 0x00, 0x83, 0x69, 0x76, 0x65, 0x64, 0x00, 0x05, 0x00, 0x00, 0x04, 0xFA, 0x01, 0x0C, 0x18,
+    0x02, 0x0F, 0x2A, 0x02, 0x12, 0x39, 0x02, 0x15, 0x4C, 0x02, 0x02, 0x3C, 0x00, 0x0F, 0x03, 0x02,
+    0x16, 0x0D, 0x02, 0x48, 0x32, 0x03, 0x56, 0x3E, 0x03, 0x81, 0x73, 0x65, 0x00, 0x4F, 0x66, 0x05,
+    0x48, 0x32, 0x03, 0x82, 0x6C, 0x73, 0x65, 0x00, 0x57, 0xD5, 0x02, 0x4F, 0xFE, 0x05, 0x48, 0x32,
+    0x03, 0x55, 0x3E, 0x03, 0x83, 0x6C, 0x74, 0x65, 0x72, 0x00, 0x44, 0x32, 0x03, 0x56, 0x3C, 0x00,
+    0x48, 0x66, 0x05, 0x83, 0x61, 0x6C, 0x73, 0x65, 0x00, 0x5A, 0xFD, 0x03, 0x44, 0x2F, 0x06, 0x55,
+    0x3C, 0x00, 0x47, 0xBD, 0x04, 0x83, 0x72, 0x77, 0x61, 0x72, 0x64, 0x00, 0x48, 0xBD, 0x04, 0x54,
+    0xC0, 0x04, 0x58, 0x00, 0x00, 0x48, 0x19, 0x06, 0x46, 0x00, 0x00, 0x5C, 0x16, 0x01, 0x81, 0x6E,
+    0x63, 0x79, 0x00, 0x02, 0x00, 0x00, 0x04, 0x6C, 0x02, 0x18, 0x8B, 0x02, 0x58, 0x3C, 0x00, 0x55,
+    0x19, 0x06, 0x44, 0xBD, 0x04, 0x51, 0x3C, 0x00, 0x57, 0xCB, 0x03, 0x48, 0xFE, 0x05, 0x48, 0x00,
+    0x00, 0x87, 0x75, 0x61, 0x72, 0x61, 0x6E, 0x74, 0x65, 0x65, 0x00, 0x44, 0x19, 0x06, 0x55, 0x3C,
+    0x00, 0x44, 0xBD, 0x04, 0x57, 0x3C, 0x00, 0x48, 0xFE, 0x05, 0x48, 0x00, 0x00, 0x82, 0x6E, 0x74,
+    0x65, 0x65, 0x00, 0x48, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x02, 0xD5, 0x02, 0x0A, 0xB2, 0x02, 0x15,
+    0xBC, 0x02, 0x57, 0x63, 0x02, 0x4B, 0xFE, 0x05, 0x81, 0x68, 0x74, 0x00, 0x44, 0xBD, 0x04, 0x55,
+    0x3C, 0x00, 0x46, 0xBD, 0x04, 0x4B, 0x16, 0x01, 0x5C, 0x36, 0x01, 0x87, 0x69, 0x65, 0x72, 0x61,
+    0x72, 0x63, 0x68, 0x79, 0x00, 0x51, 0x00, 0x00, 0x03, 0xCB, 0x03, 0x06, 0xE4, 0x02, 0x17, 0xF4,
+    0x02, 0x19, 0x20, 0x03, 0x4F, 0x16, 0x01, 0x58, 0x32, 0x03, 0x48, 0x19, 0x06, 0x47, 0x00, 0x00,
+    0x81, 0x64, 0x65, 0x00, 0x02, 0xFE, 0x05, 0x08, 0xFD, 0x02, 0x13, 0x15, 0x03, 0x55, 0x00, 0x00,
+    0x44, 0xBD, 0x04, 0x57, 0x3C, 0x00, 0x52, 0xFE, 0x05, 0x55, 0xFD, 0x03, 0x87, 0x74, 0x65, 0x72,
+    0x61, 0x74, 0x6F, 0x72, 0x00, 0x58, 0x6D, 0x04, 0x57, 0x19, 0x06, 0x83, 0x70, 0x75, 0x74, 0x00,
+    0x4F, 0x00, 0x00, 0x4C, 0x32, 0x03, 0x44, 0x4E, 0x03, 0x47, 0x5A, 0x03, 0x83, 0x61, 0x6C, 0x69,
+    0x64, 0x00, 0x03, 0x00, 0x00, 0x08, 0x3E, 0x03, 0x0C, 0x4E, 0x03, 0x12, 0x8D, 0x03, 0x51, 0x00,
+    0x00, 0x4A, 0xCB, 0x03, 0x4B, 0x63, 0x02, 0x57, 0xA3, 0x02, 0x81, 0x74, 0x68, 0x00, 0x03, 0xD5,
+    0x02, 0x04, 0x5A, 0x03, 0x05, 0x6C, 0x03, 0x16, 0x7B, 0x03, 0x56, 0x3C, 0x00, 0x4C, 0x66, 0x05,
+    0x52, 0xA2, 0x05, 0x51, 0xFD, 0x03, 0x83, 0x69, 0x73, 0x6F, 0x6E, 0x00, 0x44, 0xFE, 0x00, 0x55,
+    0x3C, 0x00, 0x5C, 0xBD, 0x04, 0x82, 0x72, 0x61, 0x72, 0x79, 0x00, 0x57, 0x66, 0x05, 0x51, 0xB4,
+    0x05, 0x48, 0xCB, 0x03, 0x55, 0x00, 0x00, 0x82, 0x65, 0x6E, 0x65, 0x72, 0x00, 0x52, 0xFD, 0x03,
+    0x02, 0xFD, 0x03, 0x16, 0x99, 0x03, 0x18, 0xA7, 0x03, 0x48, 0x66, 0x05, 0x56, 0x89, 0x05, 0x6C,
+    0x66, 0x05, 0x84, 0x73, 0x65, 0x73, 0x00, 0x53, 0x37, 0x04, 0x81, 0x6B, 0x75, 0x70, 0x00, 0x44,
+    0x00, 0x00, 0x51, 0x3C, 0x00, 0x48, 0xCB, 0x03, 0x49, 0x00, 0x00, 0x4C, 0xE8, 0x01, 0x56, 0x18,
+    0x02, 0x57, 0x66, 0x05, 0x84, 0x69, 0x66, 0x65, 0x73, 0x74, 0x00, 0x44, 0x00, 0x00, 0x50, 0x3C,
+    0x00, 0x48, 0xAF, 0x03, 0x56, 0x00, 0x00, 0x02, 0x66, 0x05, 0x04, 0xE0, 0x03, 0x13, 0xEF, 0x03,
+    0x53, 0x78, 0x05, 0x46, 0x8E, 0x00, 0x48, 0x16, 0x01, 0x83, 0x70, 0x61, 0x63, 0x65, 0x00, 0x46,
+    0x6D, 0x04, 0x44, 0x16, 0x01, 0x48, 0x25, 0x01, 0x82, 0x61, 0x63, 0x65, 0x00, 0x03, 0x00, 0x00,
+    0x06, 0x09, 0x04, 0x18, 0x37, 0x04, 0x19, 0x58, 0x04, 0x46, 0x16, 0x01, 0x02, 0x16, 0x01, 0x04,
+    0x15, 0x04, 0x18, 0x29, 0x04, 0x56, 0x25, 0x01, 0x56, 0x66, 0x05, 0x4C, 0x66, 0x05, 0x52, 0xA2,
+    0x05, 0x51, 0xFD, 0x03, 0x83, 0x69, 0x6F, 0x6E, 0x00, 0x55, 0x19, 0x06, 0x48, 0xBD, 0x04, 0x47,
+    0xC0, 0x04, 0x81, 0x72, 0x65, 0x64, 0x00, 0x53, 0x19, 0x06, 0x02, 0x6D, 0x04, 0x17, 0x43, 0x04,
+    0x18, 0x4F, 0x04, 0x58, 0xFE, 0x05, 0x57, 0x19, 0x06, 0x83, 0x74, 0x70, 0x75, 0x74, 0x00, 0x57,
+    0x19, 0x06, 0x82, 0x74, 0x70, 0x75, 0x74, 0x00, 0x48, 0x00, 0x00, 0x55, 0x00, 0x00, 0x4C, 0xBD,
+    0x04, 0x47, 0xD5, 0x02, 0x48, 0xD0, 0x01, 0x82, 0x72, 0x69, 0x64, 0x65, 0x00, 0x03, 0x00, 0x00,
+    0x12, 0x79, 0x04, 0x15, 0x8F, 0x04, 0x16, 0xAB, 0x04, 0x56, 0xFD, 0x03, 0x57, 0x66, 0x05, 0x4C,
+    0xB4, 0x05, 0x52, 0xBD, 0x05, 0x51, 0xFD, 0x03, 0x83, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x4C,
+    0xBD, 0x04, 0x59, 0xD5, 0x02, 0x4C, 0x00, 0x00, 0x4F, 0xD5, 0x02, 0x48, 0x32, 0x03, 0x47, 0x3E,
+    0x03, 0x4A, 0xD0, 0x01, 0x48, 0x63, 0x02, 0x82, 0x67, 0x65, 0x00, 0x58, 0x66, 0x05, 0x48, 0x19,
+    0x06, 0x47, 0x00, 0x00, 0x52, 0xD0, 0x01, 0x83, 0x65, 0x75, 0x64, 0x6F, 0x00, 0x48, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x06, 0xD5, 0x04, 0x09, 0xE7, 0x04, 0x0F, 0xF8, 0x04, 0x13, 0x0C, 0x05, 0x17,
+    0x2A, 0x05, 0x18, 0x45, 0x05, 0x4C, 0x16, 0x01, 0x48, 0x5B, 0x01, 0x59, 0x5E, 0x01, 0x48, 0x00,
+    0x00, 0x83, 0x65, 0x69, 0x76, 0x65, 0x00, 0x48, 0xE8, 0x01, 0x55, 0x00, 0x00, 0x48, 0xBD, 0x04,
+    0x47, 0xC0, 0x04, 0x81, 0x72, 0x65, 0x64, 0x00, 0x48, 0x32, 0x03, 0x59, 0x3E, 0x03, 0x48, 0x00,
+    0x00, 0x51, 0x00, 0x00, 0x57, 0xCB, 0x03, 0x82, 0x61, 0x6E, 0x74, 0x00, 0x4C, 0x6D, 0x04, 0x57,
+    0xD5, 0x02, 0x4C, 0xFE, 0x05, 0x57, 0xD5, 0x02, 0x4C, 0xFE, 0x05, 0x52, 0xD5, 0x02, 0x51, 0xFD,
+    0x03, 0x86, 0x65, 0x74, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x02, 0xFE, 0x05, 0x15, 0x33, 0x05,
+    0x18, 0x3E, 0x05, 0x58, 0xBD, 0x04, 0x51, 0x19, 0x06, 0x82, 0x75, 0x72, 0x6E, 0x00, 0x51, 0x19,
+    0x06, 0x80, 0x72, 0x6E, 0x00, 0x02, 0x19, 0x06, 0x16, 0x4E, 0x05, 0x17, 0x5A, 0x05, 0x4F, 0x66,
+    0x05, 0x57, 0x32, 0x03, 0x83, 0x73, 0x75, 0x6C, 0x74, 0x00, 0x55, 0xFE, 0x05, 0x51, 0xBD, 0x04,
+    0x83, 0x74, 0x75, 0x72, 0x6E, 0x00, 0x05, 0x00, 0x00, 0x04, 0x78, 0x05, 0x08, 0x89, 0x05, 0x0C,
+    0xA2, 0x05, 0x17, 0xB4, 0x05, 0x1A, 0xD9, 0x05, 0x49, 0x3C, 0x00, 0x57, 0xE8, 0x01, 0x48, 0xFE,
+    0x05, 0x5C, 0x00, 0x00, 0x82, 0x65, 0x74, 0x79, 0x00, 0x53, 0x00, 0x00, 0x48, 0x6D, 0x04, 0x55,
+    0x00, 0x00, 0x44, 0xBD, 0x04, 0x57, 0x3C, 0x00, 0x48, 0xFE, 0x05, 0x84, 0x61, 0x72, 0x61, 0x74,
+    0x65, 0x00, 0x51, 0xD5, 0x02, 0x4A, 0xD8, 0x02, 0x48, 0x63, 0x02, 0x47, 0x00, 0x00, 0x83, 0x67,
+    0x6E, 0x65, 0x64, 0x00, 0x02, 0xFE, 0x05, 0x0C, 0xBD, 0x05, 0x15, 0xCC, 0x05, 0x55, 0xD5, 0x02,
+    0x51, 0xBD, 0x04, 0x4A, 0xCB, 0x03, 0x83, 0x72, 0x69, 0x6E, 0x67, 0x00, 0x4C, 0xBD, 0x04, 0x4A,
+    0xD5, 0x02, 0x51, 0x63, 0x02, 0x81, 0x6E, 0x67, 0x00, 0x02, 0x2F, 0x06, 0x0C, 0xE2, 0x05, 0x17,
+    0xEF, 0x05, 0x57, 0x32, 0x06, 0x4B, 0xFE, 0x05, 0x46, 0x01, 0x06, 0x81, 0x63, 0x68, 0x00, 0x4C,
+    0xFE, 0x05, 0x46, 0xD5, 0x02, 0x4B, 0x16, 0x01, 0x83, 0x69, 0x74, 0x63, 0x68, 0x00, 0x4B, 0x00,
+    0x00, 0x55, 0xA3, 0x02, 0x48, 0xBD, 0x04, 0x56, 0xC0, 0x04, 0x52, 0x66, 0x05, 0x4F, 0xFD, 0x03,
+    0x47, 0x32, 0x03, 0x82, 0x68, 0x6F, 0x6C, 0x64, 0x00, 0x47, 0x00, 0x00, 0x53, 0xD0, 0x01, 0x44,
+    0x6D, 0x04, 0x57, 0x3C, 0x00, 0x48, 0xFE, 0x05, 0x84, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00, 0x4C,
+    0x00, 0x00, 0x47, 0xD5, 0x02, 0x4B, 0xD0, 0x01, 0x57, 0xA3, 0x02, 0x81, 0x74, 0x68, 0x00, 0x02,
+    0x00, 0x00, 0x0A, 0x48, 0x06, 0x17, 0x5A, 0x06, 0x58, 0x63, 0x02, 0x44, 0x8B, 0x02, 0x4A, 0x8E,
+    0x02, 0x48, 0x63, 0x02, 0x83, 0x61, 0x75, 0x67, 0x65, 0x00, 0x02, 0xFE, 0x05, 0x0B, 0x63, 0x06,
+    0x18, 0x88, 0x06, 0x02, 0x01, 0x06, 0x08, 0x6C, 0x06, 0x0C, 0x7D, 0x06, 0x6C, 0xA6, 0x02, 0x57,
+    0x3F, 0x06, 0x4B, 0x5A, 0x06, 0x48, 0x63, 0x06, 0x6C, 0x6C, 0x06, 0x84, 0x00, 0x48, 0xD5, 0x02,
+    0x55, 0x00, 0x00, 0x82, 0x65, 0x69, 0x72, 0x00, 0x55, 0x19, 0x06, 0x48, 0xBD, 0x04, 0x82, 0x72,
+    0x75, 0x65, 0x00
+};
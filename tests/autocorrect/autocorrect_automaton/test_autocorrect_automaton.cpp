@@ -0,0 +1,39 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../autocorrect_reference.hpp"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::InSequence;
+
+// Default dictionary, serialized as an automaton by `qmk generate-autocorrect-data --automaton`.
+TEST_F(AutocorrectEngine, AutomatonMatchesReference) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    expect_autocorrect_matches_reference(*this, 2000);
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+// Test that typing "fales" autocorrects to "false"
+TEST_F(AutocorrectEngine, AutomatonAppliesCorrection) {
+    TestDriver driver;
+    recording = false;
+
+    EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport())).Times(AnyNumber());
+    { // Expect the following reports in this order.
+        InSequence s;
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_F)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_A)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_L)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_BACKSPACE)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_S)));
+        EXPECT_CALL(driver, send_keyboard_mock(KeyboardReport(KC_E)));
+    }
+    type("fales");
+
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,307 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "keycode.h"
+#include "test_common.hpp"
+
+/**
+ * @brief Checks an autocorrect engine against a plain string search.
+ *
+ * Both the trie and the automaton data used by the autocorrect tests are
+ * generated from the default dictionary below. The same pseudo-random input is
+ * typed through the keyboard, and every correction the engine applies is
+ * compared against what the reference model expects.
+ */
+
+struct AutocorrectEvent {
+    size_t      position;
+    uint8_t     backspaces;
+    std::string changes;
+
+    bool operator==(const AutocorrectEvent& other) const {
+        return position == other.position && backspaces == other.backspaces && changes == other.changes;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const AutocorrectEvent& event) {
+    return os << "{" << event.position << ", " << (int)event.backspaces << ", \"" << event.changes << "\"}";
+}
+
+// clang-format off
+static const std::vector<std::pair<std::string, std::string>> autocorrect_reference_dictionary = {
+    {":guage", "gauge"},
+    {":the:the:", "the"},
+    {":thier", "their"},
+    {":ture", "true"},
+    {"accomodate", "accommodate"},
+    {"acommodate", "accommodate"},
+    {"aparent", "apparent"},
+    {"aparrent", "apparent"},
+    {"apparant", "apparent"},
+    {"apparrent", "apparent"},
+    {"aquire", "acquire"},
+    {"becuase", "because"},
+    {"cauhgt", "caught"},
+    {"cheif", "chief"},
+    {"choosen", "chosen"},
+    {"cieling", "ceiling"},
+    {"collegue", "colleague"},
+    {"concensus", "consensus"},
+    {"contians", "contains"},
+    {"cosnt", "const"},
+    {"dervied", "derived"},
+    {"fales", "false"},
+    {"fasle", "false"},
+    {"fitler", "filter"},
+    {"flase", "false"},
+    {"foward", "forward"},
+    {"frequecy", "frequency"},
+    {"gaurantee", "guarantee"},
+    {"guaratee", "guarantee"},
+    {"heigth", "height"},
+    {"heirarchy", "hierarchy"},
+    {"inclued", "include"},
+    {"interator", "iterator"},
+    {"intput", "input"},
+    {"invliad", "invalid"},
+    {"lenght", "length"},
+    {"liasion", "liaison"},
+    {"libary", "library"},
+    {"listner", "listener"},
+    {"looses:", "loses"},
+    {"looup", "lookup"},
+    {"manefist", "manifest"},
+    {"namesapce", "namespace"},
+    {"namespcae", "namespace"},
+    {"occassion", "occasion"},
+    {"occured", "occurred"},
+    {"ouptut", "output"},
+    {"ouput", "output"},
+    {"overide", "override"},
+    {"postion", "position"},
+    {"priviledge", "privilege"},
+    {"psuedo", "pseudo"},
+    {"recieve", "receive"},
+    {"refered", "referred"},
+    {"relevent", "relevant"},
+    {"repitition", "repetition"},
+    {"retrun", "return"},
+    {"retun", "return"},
+    {"reuslt", "result"},
+    {"reutrn", "return"},
+    {"saftey", "safety"},
+    {"seperate", "separate"},
+    {"singed", "signed"},
+    {"stirng", "string"},
+    {"strign", "string"},
+    {"swithc", "switch"},
+    {"swtich", "switch"},
+    {"thresold", "threshold"},
+    {"udpate", "update"},
+    {"widht", "width"},
+};
+// clang-format on
+
+static inline uint8_t autocorrect_reference_keycode(char c) {
+    switch (c) {
+        case ':':
+        case ' ':
+            return KC_SPC;
+        case '\'':
+            return KC_QUOTE;
+        default:
+            return c - 'a' + KC_A;
+    }
+}
+
+class AutocorrectReference {
+   public:
+    AutocorrectReference() {
+        for (const auto& entry : autocorrect_reference_dictionary) {
+            max_length = std::max(max_length, entry.first.size());
+        }
+    }
+
+    /**
+     * @brief Feeds one character of input: a-z, space, quote, '\b' for
+     * backspace or '\n' for enter, mirroring process_autocorrect().
+     */
+    void tap(char c) {
+        position++;
+        if (c == '\b') {
+            if (!buffer.empty()) {
+                buffer.pop_back();
+            }
+            return;
+        }
+        if (c == '\n') {
+            buffer.clear();
+            c = ' ';
+        }
+
+        uint8_t keycode = autocorrect_reference_keycode(c);
+        if (buffer.size() >= max_length) {
+            buffer.erase(buffer.begin());
+        }
+        buffer.push_back(keycode);
+
+        for (const auto& entry : autocorrect_reference_dictionary) {
+            const std::string& typo = entry.first;
+            if (typo.size() > buffer.size() || !std::equal(typo.begin(), typo.end(), buffer.end() - typo.size(), [](char t, uint8_t k) { return autocorrect_reference_keycode(t) == k; })) {
+                continue;
+            }
+
+            // Same encoding as the generator uses for leaf nodes.
+            std::string word   = typo.substr(typo.front() == ':', typo.size() - (typo.front() == ':') - (typo.back() == ':'));
+            size_t      common = 0;
+            while (common < std::min(word.size(), entry.second.size()) && word[common] == entry.second[common]) {
+                common++;
+            }
+            corrections.push_back({position, (uint8_t)(word.size() - common - 1 + (typo.back() == ':')), entry.second.substr(common)});
+
+            buffer.clear();
+            if (keycode == KC_SPC) {
+                buffer.push_back(KC_SPC);
+            }
+            break;
+        }
+    }
+
+    std::vector<AutocorrectEvent> corrections;
+
+   private:
+    std::vector<uint8_t> buffer{KC_SPC};
+    size_t               position   = 0;
+    size_t               max_length = 0;
+};
+
+/**
+ * @brief Builds a reproducible stream of typos, correct words, random
+ * letters, backspaces and enters.
+ */
+static inline std::string autocorrect_reference_input(size_t words) {
+    std::string input;
+    uint32_t    seed = 12345;
+    auto        next = [&seed](uint32_t range) {
+        seed = seed * 1103515245 + 12345;
+        return (seed >> 16) % range;
+    };
+
+    for (size_t i = 0; i < words; i++) {
+        const auto& entry = autocorrect_reference_dictionary[next(autocorrect_reference_dictionary.size())];
+        std::string word;
+        switch (next(5)) {
+            case 0:
+            case 1:
+                word = entry.first;
+                break;
+            case 2:
+                word = entry.second;
+                break;
+            case 3:
+                // A partial typo running into another one exercises failure links.
+                word = entry.first.substr(0, 1 + next(entry.first.size())) + autocorrect_reference_dictionary[next(autocorrect_reference_dictionary.size())].first;
+                break;
+            default:
+                for (uint32_t n = 1 + next(8); n > 0; n--) {
+                    word += (char)('a' + next(26));
+                }
+                break;
+        }
+        for (char c : word) {
+            if (c == ':') {
+                c = ' ';
+            } else if (next(40) == 0) {
+                input += '\b';
+            }
+            input += c;
+        }
+        input += next(30) == 0 ? '\n' : ' ';
+    }
+    return input;
+}
+
+/**
+ * @brief Fixture typing input through the keyboard, while recording the
+ * corrections passed to apply_autocorrect() instead of applying them.
+ */
+class AutocorrectEngine : public TestFixture {
+   public:
+    static bool                          recording;
+    static size_t                        position;
+    static std::vector<AutocorrectEvent> corrections;
+
+    static bool record(uint8_t backspaces, const char* str) {
+        if (!recording) {
+            return true;
+        }
+        corrections.push_back({position, backspaces, str});
+        return false;
+    }
+
+    void SetUp() override {
+        autocorrect_enable();
+        recording = true;
+        position  = 0;
+        corrections.clear();
+        for (char c = 'a'; c <= 'z'; c++) {
+            keys.emplace(c, KeymapKey(0, (c - 'a') % MATRIX_COLS, (c - 'a') / MATRIX_COLS, c - 'a' + KC_A));
+        }
+        keys.emplace(' ', KeymapKey(0, 6, 2, KC_SPC));
+        keys.emplace('\'', KeymapKey(0, 7, 2, KC_QUOTE));
+        keys.emplace('\b', KeymapKey(0, 8, 2, KC_BSPC));
+        keys.emplace('\n', KeymapKey(0, 9, 2, KC_ENTER));
+        for (const auto& key : keys) {
+            add_key(key.second);
+        }
+    }
+
+    void type(const std::string& input) {
+        for (char c : input) {
+            position++;
+            KeymapKey key = keys.at(c);
+            key.press();
+            run_one_scan_loop();
+            key.release();
+            run_one_scan_loop();
+        }
+    }
+
+    void TearDown() override {
+        recording = false;
+    }
+
+    std::map<char, KeymapKey> keys;
+};
+
+bool                          AutocorrectEngine::recording = false;
+size_t                        AutocorrectEngine::position  = 0;
+std::vector<AutocorrectEvent> AutocorrectEngine::corrections;
+
+extern "C" bool apply_autocorrect(uint8_t backspaces, const char* str, char* typo, char* correct) {
+    return AutocorrectEngine::record(backspaces, str);
+}
+
+/**
+ * @brief Types the same input through the engine under test and the reference
+ * model, and expects identical corrections.
+ */
+static inline void expect_autocorrect_matches_reference(AutocorrectEngine& fixture, size_t words) {
+    std::string          input = autocorrect_reference_input(words);
+    AutocorrectReference reference;
+    for (char c : input) {
+        reference.tap(c);
+    }
+
+    fixture.type(input);
+
+    EXPECT_FALSE(reference.corrections.empty());
+    EXPECT_EQ(AutocorrectEngine::corrections, reference.corrections);
+}
@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "autocorrect_reference.hpp"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+
+// Default dictionary, serialized as a trie.
+TEST_F(AutocorrectEngine, TrieMatchesReference) {
+    TestDriver driver;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    expect_autocorrect_matches_reference(*this, 2000);
+
+    VERIFY_AND_CLEAR(driver);
+}
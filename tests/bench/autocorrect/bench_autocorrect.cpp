@@ -0,0 +1,35 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Uses the default dictionary, see autocorrect_data_default.h
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class AutocorrectBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_a{0, 0, 0, KC_A};
+    KeymapKey key_e{0, 1, 0, KC_E};
+    KeymapKey key_f{0, 2, 0, KC_F};
+    KeymapKey key_l{0, 3, 0, KC_L};
+    KeymapKey key_s{0, 4, 0, KC_S};
+    KeymapKey key_t{0, 5, 0, KC_T};
+    KeymapKey key_spc{0, 6, 0, KC_SPC};
+
+    void SetUp() override {
+        set_keymap({key_a, key_e, key_f, key_l, key_s, key_t, key_spc});
+        autocorrect_enable();
+    }
+};
+
+TEST_F(AutocorrectBenchmark, Word) {
+    auto result = measure("word", 1000, [&]() { tap_keys(key_s, key_e, key_a, key_t, key_spc); });
+
+    EXPECT_EQ(result.reports, 10 * result.repetitions);
+}
+
+TEST_F(AutocorrectBenchmark, Typo) {
+    // "fales" is corrected to "false", with two backspaces and "se"
+    auto result = measure("typo", 1000, [&]() { tap_keys(key_f, key_a, key_l, key_e, key_s, key_spc); });
+
+    EXPECT_GT(result.reports, 12 * result.repetitions);
+}
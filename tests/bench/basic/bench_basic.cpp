@@ -0,0 +1,46 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The cost of the keyboard task with no optional features, to compare the other benchmarks against
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class BasicBenchmark : public Benchmark {};
+
+TEST_F(BasicBenchmark, Idle) {
+    set_keymap({KeymapKey(0, 0, 0, KC_A)});
+
+    measure("idle", 100, [&]() { idle_for(100); });
+}
+
+TEST_F(BasicBenchmark, Typing) {
+    KeymapKey key_q(0, 0, 0, KC_Q);
+    KeymapKey key_w(0, 1, 0, KC_W);
+    KeymapKey key_e(0, 2, 0, KC_E);
+    KeymapKey key_lsft(0, 0, 1, KC_LSFT);
+    set_keymap({key_q, key_w, key_e, key_lsft});
+
+    measure("typing", 1000, [&]() {
+        tap_keys(key_q, key_w, key_e);
+        key_lsft.press();
+        run_one_scan_loop();
+        tap_key(key_q);
+        key_lsft.release();
+        run_one_scan_loop();
+    });
+}
+
+TEST_F(BasicBenchmark, Layers) {
+    KeymapKey key_mo(0, 0, 0, MO(1));
+    KeymapKey key_a(0, 1, 0, KC_A);
+    KeymapKey key_b(1, 1, 0, KC_B);
+    set_keymap({key_mo, key_a, key_b, KeymapKey(1, 0, 0, KC_TRNS)});
+
+    measure("momentary layer", 1000, [&]() {
+        key_mo.press();
+        run_one_scan_loop();
+        tap_key(key_a);
+        key_mo.release();
+        run_one_scan_loop();
+    });
+}
@@ -0,0 +1,32 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class CapsWordBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_cw{0, 0, 0, CW_TOGG};
+    KeymapKey key_a{0, 1, 0, KC_A};
+    KeymapKey key_b{0, 2, 0, KC_B};
+    KeymapKey key_mins{0, 3, 0, KC_MINS};
+    KeymapKey key_spc{0, 4, 0, KC_SPC};
+
+    void SetUp() override {
+        set_keymap({key_cw, key_a, key_b, key_mins, key_spc});
+    }
+};
+
+TEST_F(CapsWordBenchmark, RegularKeys) {
+    auto result = measure("regular keys", 1000, [&]() { tap_keys(key_a, key_b, key_spc); });
+
+    EXPECT_EQ(result.reports, 6 * result.repetitions);
+}
+
+TEST_F(CapsWordBenchmark, Word) {
+    // Shift is applied to the letters, and the space ends the word
+    auto result = measure("word", 1000, [&]() { tap_keys(key_cw, key_a, key_mins, key_b, key_spc); });
+
+    EXPECT_FALSE(is_caps_word_on());
+    EXPECT_GT(result.reports, 6 * result.repetitions);
+}
@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class ComboBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_j{0, 0, 0, KC_J};
+    KeymapKey key_k{0, 1, 0, KC_K};
+    KeymapKey key_l{0, 2, 0, KC_L};
+    KeymapKey key_a{0, 3, 0, KC_A};
+    KeymapKey key_n{0, 4, 0, KC_N};
+
+    void SetUp() override {
+        set_keymap({key_j, key_k, key_l, key_a, key_n});
+    }
+};
+
+TEST_F(ComboBenchmark, NonComboKeys) {
+    auto result = measure("non-combo keys", 1000, [&]() { tap_keys(key_a, key_n); });
+
+    EXPECT_EQ(result.reports, 4 * result.repetitions);
+}
+
+TEST_F(ComboBenchmark, Chord) {
+    auto result = measure("chord", 1000, [&]() { tap_combo({key_j, key_k}); });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
+
+TEST_F(ComboBenchmark, ComboKeyTimesOut) {
+    // J starts J + K and J + K + L, and is only sent once the combo term runs out
+    auto result = measure("combo key timing out", 200, [&]() {
+        key_j.press();
+        idle_for(COMBO_TERM + 1);
+        key_j.release();
+        run_one_scan_loop();
+    });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
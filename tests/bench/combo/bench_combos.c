@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// A typical set of home row and vertical combos, J + K is the one the benchmark taps
+const uint16_t PROGMEM jk_combo[] = {KC_J, KC_K, COMBO_END};
+const uint16_t PROGMEM df_combo[] = {KC_D, KC_F, COMBO_END};
+const uint16_t PROGMEM sd_combo[] = {KC_S, KC_D, COMBO_END};
+const uint16_t PROGMEM kl_combo[] = {KC_K, KC_L, COMBO_END};
+const uint16_t PROGMEM we_combo[] = {KC_W, KC_E, COMBO_END};
+const uint16_t PROGMEM er_combo[] = {KC_E, KC_R, COMBO_END};
+const uint16_t PROGMEM ui_combo[] = {KC_U, KC_I, COMBO_END};
+const uint16_t PROGMEM io_combo[] = {KC_I, KC_O, COMBO_END};
+const uint16_t PROGMEM xc_combo[] = {KC_X, KC_C, COMBO_END};
+const uint16_t PROGMEM cv_combo[] = {KC_C, KC_V, COMBO_END};
+const uint16_t PROGMEM mc_combo[] = {KC_M, KC_COMM, COMBO_END};
+const uint16_t PROGMEM cd_combo[] = {KC_COMM, KC_DOT, COMBO_END};
+const uint16_t PROGMEM ed_combo[] = {KC_E, KC_D, COMBO_END};
+const uint16_t PROGMEM ik_combo[] = {KC_I, KC_K, COMBO_END};
+const uint16_t PROGMEM sdf_combo[] = {KC_S, KC_D, KC_F, COMBO_END};
+const uint16_t PROGMEM jkl_combo[] = {KC_J, KC_K, KC_L, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(jk_combo, KC_ESC),
+    COMBO(df_combo, KC_TAB),
+    COMBO(sd_combo, KC_BSPC),
+    COMBO(kl_combo, KC_ENT),
+    COMBO(we_combo, KC_LBRC),
+    COMBO(er_combo, KC_RBRC),
+    COMBO(ui_combo, KC_LPRN),
+    COMBO(io_combo, KC_RPRN),
+    COMBO(xc_combo, KC_COPY),
+    COMBO(cv_combo, KC_PASTE),
+    COMBO(mc_combo, KC_MINS),
+    COMBO(cd_combo, KC_EQL),
+    COMBO(ed_combo, KC_GRV),
+    COMBO(ik_combo, KC_QUOT),
+    COMBO(sdf_combo, KC_DEL),
+    COMBO(jkl_combo, KC_CAPS),
+};
+// clang-format on
@@ -0,0 +1,49 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// How the combo index scales with the number of combos, the parent benchmark has a typical set without an index
+#include <string>
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+static const uint16_t bench_combo_counts[] = {10, 100, 500};
+static uint16_t       bench_combo_count    = 0;
+
+extern "C" {
+void init_bench_combos(void);
+
+uint16_t combo_count(void) {
+    return bench_combo_count;
+}
+}
+
+class ComboIndexBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_j{0, 0, 0, KC_J};
+    KeymapKey key_k{0, 1, 0, KC_K};
+    KeymapKey key_a{0, 2, 0, KC_A};
+    KeymapKey key_n{0, 3, 0, KC_N};
+
+    void SetUp() override {
+        set_keymap({key_j, key_k, key_a, key_n});
+        init_bench_combos();
+    }
+};
+
+TEST_F(ComboIndexBenchmark, NonComboKeys) {
+    for (uint16_t count : bench_combo_counts) {
+        bench_combo_count = count;
+        auto result       = measure("non-combo keys, " + std::to_string(count) + " combos", 1000, [&]() { tap_keys(key_a, key_n); });
+
+        EXPECT_EQ(result.reports, 4 * result.repetitions);
+    }
+}
+
+TEST_F(ComboIndexBenchmark, Chord) {
+    for (uint16_t count : bench_combo_counts) {
+        bench_combo_count = count;
+        auto result       = measure("chord, " + std::to_string(count) + " combos", 1000, [&]() { tap_combo({key_j, key_k}); });
+
+        EXPECT_EQ(result.reports, 2 * result.repetitions);
+    }
+}
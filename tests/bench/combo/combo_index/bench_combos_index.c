@@ -0,0 +1,24 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#define BENCH_MAX_COMBOS 500
+
+// Combo 0 is J + K => B, every other combo is made of two keycodes that no
+// key in the benchmark keymap produces, so they only add to the size of the
+// index. The number of combos in use is set by overriding combo_count().
+static uint16_t bench_combo_keys[BENCH_MAX_COMBOS][3];
+
+combo_t key_combos[BENCH_MAX_COMBOS];
+
+void init_bench_combos(void) {
+    for (uint16_t i = 0; i < BENCH_MAX_COMBOS; i++) {
+        bench_combo_keys[i][0] = QK_UNICODE + 2 * i;
+        bench_combo_keys[i][1] = QK_UNICODE + 2 * i + 1;
+        bench_combo_keys[i][2] = COMBO_END;
+        key_combos[i]          = (combo_t)COMBO(bench_combo_keys[i], KC_C);
+    }
+    bench_combo_keys[0][0] = KC_J;
+    bench_combo_keys[0][1] = KC_K;
+    key_combos[0].keycode  = KC_B;
+}
@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class KeyOverrideBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_lsft{0, 0, 0, KC_LSFT};
+    KeymapKey key_bspc{0, 1, 0, KC_BSPC};
+    KeymapKey key_a{0, 2, 0, KC_A};
+    KeymapKey key_b{0, 3, 0, KC_B};
+
+    void SetUp() override {
+        set_keymap({key_lsft, key_bspc, key_a, key_b});
+    }
+};
+
+TEST_F(KeyOverrideBenchmark, RegularKeys) {
+    auto result = measure("regular keys", 1000, [&]() { tap_keys(key_a, key_b); });
+
+    EXPECT_EQ(result.reports, 4 * result.repetitions);
+}
+
+TEST_F(KeyOverrideBenchmark, ShiftedKeys) {
+    auto result = measure("shifted keys", 1000, [&]() {
+        key_lsft.press();
+        run_one_scan_loop();
+        tap_keys(key_a, key_b);
+        key_lsft.release();
+        run_one_scan_loop();
+    });
+
+    EXPECT_EQ(result.reports, 6 * result.repetitions);
+}
+
+TEST_F(KeyOverrideBenchmark, Override) {
+    // Shift + Backspace sends Delete, without Shift
+    auto result = measure("override", 1000, [&]() {
+        key_lsft.press();
+        run_one_scan_loop();
+        tap_key(key_bspc);
+        key_lsft.release();
+        run_one_scan_loop();
+    });
+
+    EXPECT_GT(result.reports, 0);
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+// A typical set of overrides, Shift + Backspace is the one the benchmark uses
+const key_override_t delete_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+const key_override_t comma_override  = ko_make_basic(MOD_MASK_SHIFT, KC_COMM, KC_SCLN);
+const key_override_t dot_override    = ko_make_basic(MOD_MASK_SHIFT, KC_DOT, KC_COLN);
+const key_override_t esc_override    = ko_make_basic(MOD_MASK_SHIFT, KC_ESC, KC_TILD);
+const key_override_t vol_override    = ko_make_basic(MOD_MASK_CTRL, KC_VOLU, KC_BRIU);
+const key_override_t home_override   = ko_make_basic(MOD_MASK_GUI, KC_LEFT, KC_HOME);
+const key_override_t end_override    = ko_make_basic(MOD_MASK_GUI, KC_RGHT, KC_END);
+const key_override_t next_override   = ko_make_basic(MOD_MASK_ALT, KC_TAB, KC_MNXT);
+
+// clang-format off
+const key_override_t *key_overrides[] = {
+    &delete_override,
+    &comma_override,
+    &dot_override,
+    &esc_override,
+    &vol_override,
+    &home_override,
+    &end_override,
+    &next_override,
+};
+// clang-format on
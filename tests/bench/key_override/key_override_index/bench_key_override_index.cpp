@@ -0,0 +1,66 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// How the override index scales with the number of overrides, the parent benchmark has a typical set without an index
+#include <string>
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+static const uint16_t bench_key_override_counts[] = {10, 50, 200};
+static uint16_t       bench_key_override_count    = 0;
+
+extern "C" {
+void init_bench_key_overrides(uint16_t count);
+
+uint16_t key_override_count(void) {
+    return bench_key_override_count;
+}
+}
+
+class KeyOverrideIndexBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_lsft{0, 0, 0, KC_LSFT};
+    KeymapKey key_esc{0, 1, 0, KC_ESC};
+    KeymapKey key_a{0, 2, 0, KC_A};
+
+    void SetUp() override {
+        set_keymap({key_lsft, key_esc, key_a});
+    }
+
+    void set_key_override_count(uint16_t count) {
+        init_bench_key_overrides(count);
+        bench_key_override_count = count;
+        key_override_index_invalidate();
+    }
+};
+
+TEST_F(KeyOverrideIndexBenchmark, ShiftedKeys) {
+    for (uint16_t count : bench_key_override_counts) {
+        set_key_override_count(count);
+        auto result = measure("shifted keys, " + std::to_string(count) + " overrides", 1000, [&]() {
+            key_lsft.press();
+            run_one_scan_loop();
+            tap_key(key_a);
+            key_lsft.release();
+            run_one_scan_loop();
+        });
+
+        EXPECT_EQ(result.reports, 4 * result.repetitions);
+    }
+}
+
+TEST_F(KeyOverrideIndexBenchmark, Override) {
+    // Shift + Esc sends Home, without Shift
+    for (uint16_t count : bench_key_override_counts) {
+        set_key_override_count(count);
+        auto result = measure("override, " + std::to_string(count) + " overrides", 1000, [&]() {
+            key_lsft.press();
+            run_one_scan_loop();
+            tap_key(key_esc);
+            key_lsft.release();
+            run_one_scan_loop();
+        });
+
+        EXPECT_EQ(result.reports, 4 * result.repetitions);
+    }
+}
@@ -0,0 +1,33 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class LeaderBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_leader{0, 0, 0, QK_LEADER};
+    KeymapKey key_a{0, 1, 0, KC_A};
+    KeymapKey key_b{0, 2, 0, KC_B};
+    KeymapKey key_c{0, 3, 0, KC_C};
+    KeymapKey key_d{0, 4, 0, KC_D};
+
+    void SetUp() override {
+        set_keymap({key_leader, key_a, key_b, key_c, key_d});
+    }
+};
+
+TEST_F(LeaderBenchmark, RegularKeys) {
+    auto result = measure("regular keys", 1000, [&]() { tap_keys(key_a, key_b); });
+
+    EXPECT_EQ(result.reports, 4 * result.repetitions);
+}
+
+TEST_F(LeaderBenchmark, Sequence) {
+    auto result = measure("sequence", 200, [&]() {
+        tap_keys(key_leader, key_a, key_b, key_c, key_d);
+        idle_for(LEADER_TIMEOUT);
+    });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
@@ -0,0 +1,22 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Every handler in process_record_quantum() that runs on the host
+AUTOCORRECT_ENABLE = yes
+CAPS_WORD_ENABLE = yes
+DYNAMIC_MACRO_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+KEY_LOCK_ENABLE = yes
+KEY_OVERRIDE_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+LEADER_ENABLE = yes
+PROGRAMMABLE_BUTTON_ENABLE = yes
+REPEAT_KEY_ENABLE = yes
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+SECURE_ENABLE = yes
+TAP_DANCE_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+UNICODE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = bench_process_record_keymap.c
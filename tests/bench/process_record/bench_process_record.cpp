@@ -0,0 +1,88 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The cost of getting a key event through process_record_quantum(), with every handler that runs on the host enabled
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class ProcessRecordBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_a{0, 0, 0, KC_A};
+    KeymapKey key_b{0, 1, 0, KC_B};
+    KeymapKey key_lsft{0, 2, 0, KC_LSFT};
+    KeymapKey key_mo{0, 3, 0, MO(1)};
+    KeymapKey key_grave_esc{0, 4, 0, QK_GRAVE_ESCAPE};
+    KeymapKey key_unicode{0, 5, 0, UC(0x00E9)};
+    KeymapKey key_user{0, 6, 0, QK_USER};
+    KeymapKey key_a_layer{1, 0, 0, KC_TRNS};
+    KeymapKey key_b_layer{1, 1, 0, KC_C};
+
+    void SetUp() override {
+        set_keymap({key_a, key_b, key_lsft, key_mo, key_grave_esc, key_unicode, key_user, key_a_layer, key_b_layer});
+    }
+};
+
+TEST_F(ProcessRecordBenchmark, BasicKeycodes) {
+    auto result = measure("basic keycodes", 1000, [&]() {
+        tap_keys(key_a, key_b);
+        key_lsft.press();
+        run_one_scan_loop();
+        tap_key(key_a);
+        key_lsft.release();
+        run_one_scan_loop();
+    });
+
+    EXPECT_EQ(result.reports, 8 * result.repetitions);
+}
+
+TEST_F(ProcessRecordBenchmark, LayerKeycodes) {
+    auto result = measure("layer keycodes", 1000, [&]() {
+        key_mo.press();
+        run_one_scan_loop();
+        tap_key(key_b);
+        key_mo.release();
+        run_one_scan_loop();
+    });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
+
+TEST_F(ProcessRecordBenchmark, QuantumKeycodes) {
+    auto result = measure("quantum keycodes", 1000, [&]() { tap_key(key_grave_esc); });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
+
+TEST_F(ProcessRecordBenchmark, UserKeycodes) {
+    auto result = measure("user keycodes", 1000, [&]() { tap_key(key_user); });
+
+    EXPECT_EQ(result.reports, 0);
+}
+
+// process_record_quantum() on its own, without the rest of the scan loop around it
+static void process_tap(const KeymapKey &key) {
+    keyrecord_t record = {};
+    record.event.key   = key.position;
+    record.event.type  = KEY_EVENT;
+
+    record.event.pressed = true;
+    record.event.time    = timer_read();
+    process_record_quantum(&record);
+    record.event.pressed = false;
+    record.event.time    = timer_read();
+    process_record_quantum(&record);
+}
+
+TEST_F(ProcessRecordBenchmark, DispatchBasicKeycode) {
+    measure_call("dispatch basic keycode", 10000, [&]() { process_tap(key_a); }, 2);
+}
+
+TEST_F(ProcessRecordBenchmark, DispatchQuantumKeycode) {
+    auto result = measure_call("dispatch quantum keycode", 10000, [&]() { process_tap(key_grave_esc); }, 2);
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
+
+TEST_F(ProcessRecordBenchmark, DispatchUserKeycode) {
+    measure_call("dispatch user keycode", 10000, [&]() { process_tap(key_user); }, 2);
+}
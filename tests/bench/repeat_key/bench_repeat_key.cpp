@@ -0,0 +1,37 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+class RepeatKeyBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_a{0, 0, 0, KC_A};
+    KeymapKey key_b{0, 1, 0, KC_B};
+    KeymapKey key_repeat{0, 2, 0, QK_REP};
+    KeymapKey key_alt_repeat{0, 3, 0, QK_AREP};
+    KeymapKey key_left{0, 4, 0, KC_LEFT};
+
+    void SetUp() override {
+        set_keymap({key_a, key_b, key_repeat, key_alt_repeat, key_left});
+    }
+};
+
+TEST_F(RepeatKeyBenchmark, RegularKeys) {
+    auto result = measure("regular keys", 1000, [&]() { tap_keys(key_a, key_b); });
+
+    EXPECT_EQ(result.reports, 4 * result.repetitions);
+}
+
+TEST_F(RepeatKeyBenchmark, Repeat) {
+    auto result = measure("repeat", 1000, [&]() { tap_keys(key_a, key_repeat, key_repeat); });
+
+    EXPECT_EQ(result.reports, 6 * result.repetitions);
+}
+
+TEST_F(RepeatKeyBenchmark, AltRepeat) {
+    // Left is reversed to Right
+    auto result = measure("alternate repeat", 1000, [&]() { tap_keys(key_left, key_alt_repeat); });
+
+    EXPECT_EQ(result.reports, 4 * result.repetitions);
+}
@@ -0,0 +1,70 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+class RgbMatrixBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_a{0, 0, 0, KC_A};
+    KeymapKey key_b{0, 5, 2, KC_B};
+
+    void SetUp() override {
+        set_keymap({key_a, key_b});
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 255, 255);
+    }
+
+    void TearDown() override {
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    }
+
+    // Typing at a steady pace, so that the effect renders a few frames per key
+    void measure_effect(const char* name, uint8_t mode) {
+        rgb_matrix_mode_noeeprom(mode);
+        measure(name, 50, [&]() {
+            tap_key(key_a);
+            idle_for(50);
+            tap_key(key_b);
+            idle_for(50);
+        });
+    }
+};
+
+TEST_F(RgbMatrixBenchmark, Effects) {
+    measure_effect("solid color", RGB_MATRIX_SOLID_COLOR);
+    measure_effect("breathing", RGB_MATRIX_BREATHING);
+    measure_effect("cycle left right", RGB_MATRIX_CYCLE_LEFT_RIGHT);
+    measure_effect("rainbow beacon", RGB_MATRIX_RAINBOW_BEACON);
+    measure_effect("pixel fractal", RGB_MATRIX_PIXEL_FRACTAL);
+    measure_effect("typing heatmap", RGB_MATRIX_TYPING_HEATMAP);
+    measure_effect("digital rain", RGB_MATRIX_DIGITAL_RAIN);
+    measure_effect("solid reactive simple", RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    measure_effect("solid reactive multiwide", RGB_MATRIX_SOLID_REACTIVE_MULTIWIDE);
+    measure_effect("solid multisplash", RGB_MATRIX_SOLID_MULTISPLASH);
+}
+
+TEST_F(RgbMatrixBenchmark, Disabled) {
+    rgb_matrix_disable_noeeprom();
+    measure("disabled", 50, [&]() {
+        tap_key(key_a);
+        idle_for(50);
+        tap_key(key_b);
+        idle_for(50);
+    });
+}
+
+// The key event on its own, which spreads heat over every LED nearby
+TEST_F(RgbMatrixBenchmark, HeatmapKeyEvent) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+    measure_call("typing heatmap key event", 1000, [&]() {
+        rgb_matrix_handle_key_event(key_b.position.row, key_b.position.col, true);
+        rgb_matrix_handle_key_event(key_b.position.row, key_b.position.col, false);
+    }, 2);
+}
@@ -0,0 +1,5 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Same effects as the parent benchmark, with the distances cached
+#include "../bench_rgb_matrix.hpp"
@@ -0,0 +1,43 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+enum { SEND_WORD = SAFE_RANGE, SEND_SENTENCE };
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    if (record->event.pressed) {
+        switch (keycode) {
+            case SEND_WORD:
+                SEND_STRING("qmk");
+                return false;
+            case SEND_SENTENCE:
+                SEND_STRING("The quick brown fox jumps over the lazy dog.\n");
+                return false;
+        }
+    }
+    return true;
+}
+
+class SendStringBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_word{0, 0, 0, SEND_WORD};
+    KeymapKey key_sentence{0, 1, 0, SEND_SENTENCE};
+
+    void SetUp() override {
+        set_keymap({key_word, key_sentence});
+    }
+};
+
+TEST_F(SendStringBenchmark, Word) {
+    auto result = measure("word", 1000, [&]() { tap_key(key_word); });
+
+    EXPECT_EQ(result.reports, 6 * result.repetitions);
+}
+
+TEST_F(SendStringBenchmark, Sentence) {
+    auto result = measure("sentence", 200, [&]() { tap_key(key_sentence); });
+
+    EXPECT_GE(result.reports, 2 * 45 * result.repetitions);
+}
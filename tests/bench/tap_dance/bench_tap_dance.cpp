@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "benchmark.hpp"
+#include "bench_tap_dances.h"
+
+class TapDanceBenchmark : public Benchmark {
+   protected:
+    KeymapKey key_esc_caps{0, 0, 0, TD(TD_ESC_CAPS)};
+    KeymapKey key_count{0, 1, 0, TD(TD_COUNT)};
+    KeymapKey key_a{0, 2, 0, KC_A};
+    KeymapKey key_b{0, 3, 0, KC_B};
+
+    void SetUp() override {
+        set_keymap({key_esc_caps, key_count, key_a, key_b});
+    }
+};
+
+TEST_F(TapDanceBenchmark, RegularKeys) {
+    auto result = measure("regular keys", 1000, [&]() { tap_keys(key_a, key_b); });
+
+    EXPECT_EQ(result.reports, 4 * result.repetitions);
+}
+
+TEST_F(TapDanceBenchmark, SingleTap) {
+    auto result = measure("single tap", 200, [&]() {
+        tap_key(key_esc_caps);
+        idle_for(TAPPING_TERM);
+    });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
+
+TEST_F(TapDanceBenchmark, DoubleTap) {
+    auto result = measure("double tap", 200, [&]() {
+        tap_keys(key_esc_caps, key_esc_caps);
+        idle_for(TAPPING_TERM);
+    });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
+
+TEST_F(TapDanceBenchmark, Interrupted) {
+    auto result = measure("interrupted", 1000, [&]() { tap_keys(key_count, key_a); });
+
+    EXPECT_EQ(result.reports, 4 * result.repetitions);
+}
+
+TEST_F(TapDanceBenchmark, Hold) {
+    auto result = measure("hold", 200, [&]() {
+        key_count.press();
+        idle_for(TAPPING_TERM + 1);
+        key_count.release();
+        run_one_scan_loop();
+    });
+
+    EXPECT_EQ(result.reports, 2 * result.repetitions);
+}
@@ -0,0 +1,22 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+#include "bench_tap_dances.h"
+
+// Sends the number of taps, or holds Ctrl when held
+static void count_finished(tap_dance_state_t *state, void *user_data) {
+    if (state->pressed && !state->interrupted) {
+        register_code(KC_LCTL);
+    } else {
+        register_code(KC_1 + MIN(state->count, 9) - 1);
+    }
+}
+
+static void count_reset(tap_dance_state_t *state, void *user_data) {
+    clear_keyboard();
+}
+
+tap_dance_action_t tap_dance_actions[] = {
+    [TD_ESC_CAPS] = ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_CAPS),
+    [TD_COUNT]    = ACTION_TAP_DANCE_FN_ADVANCED(NULL, count_finished, count_reset),
+};
@@ -0,0 +1,22 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs wear_leveling.c against the mock backing store from its unit tests
+OPT_DEFS += \
+    -DWEAR_LEVELING_TESTS \
+    -DBACKING_STORE_WRITE_SIZE=2 \
+    -DWEAR_LEVELING_BACKING_SIZE=8192 \
+    -DWEAR_LEVELING_LOGICAL_SIZE=2048 \
+    -DWEAR_LEVELING_INCREMENTAL_CONSOLIDATION
+
+SRC += \
+    $(LIB_PATH)/fnv/qmk_fnv_type_validation.c \
+    $(LIB_PATH)/fnv/hash_32a.c \
+    $(LIB_PATH)/fnv/hash_64a.c \
+    $(QUANTUM_PATH)/wear_leveling/wear_leveling.c \
+    $(QUANTUM_PATH)/wear_leveling/tests/backing_mocks.cpp
+
+COMMON_VPATH += \
+    $(LIB_PATH)/fnv \
+    $(QUANTUM_PATH)/wear_leveling \
+    $(QUANTUM_PATH)/wear_leveling/tests
@@ -0,0 +1,154 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The pass/fail checks for incremental consolidation and run-length entries are in
+// quantum/wear_leveling/tests/wear_leveling_incremental.cpp, this only reports the costs
+#include <cstdio>
+#include <random>
+#include "test_common.hpp"
+#include "benchmark.hpp"
+#include "backing_mocks.hpp"
+
+#define LOG_SIZE (WEAR_LEVELING_BACKING_SIZE - WEAR_LEVELING_LOGICAL_SIZE - 8)
+#define KEYMAP_SIZE (8 * 6 * 17 * 2)
+
+class WearLevelingBenchmark : public Benchmark {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+};
+
+struct workload_stats_t {
+    std::size_t logical_bytes = 0; // bytes passed to wear_leveling_write()
+    std::size_t max_burst     = 0; // most backing store writes made by a single call
+};
+
+// Writes, and optionally runs the housekeeping task after each write, keeping track of the largest burst of backing writes
+static void run_write(workload_stats_t& stats, bool task, uint32_t address, const void* value, size_t length) {
+    auto& inst = MockBackingStore::Instance();
+
+    uint64_t before = inst.write_invoke_count();
+    EXPECT_NE(wear_leveling_write(address, value, length), WEAR_LEVELING_FAILED) << "Write failed";
+    stats.max_burst = std::max<std::size_t>(stats.max_burst, inst.write_invoke_count() - before);
+    stats.logical_bytes += length;
+
+    if (task) {
+        before = inst.write_invoke_count();
+        EXPECT_NE(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task failed";
+        stats.max_burst = std::max<std::size_t>(stats.max_burst, inst.write_invoke_count() - before);
+    }
+}
+
+/**
+ * Measures the cost of init, as the write log fills up.
+ */
+TEST_F(WearLevelingBenchmark, InitByLogFill) {
+    auto&        inst = MockBackingStore::Instance();
+    std::mt19937 rng(1);
+
+    printf("[ BENCH    ] init with %u byte logical size, %u byte write log:\n", WEAR_LEVELING_LOGICAL_SIZE, LOG_SIZE);
+    for (int fill = 0; fill <= 100; fill += 25) {
+        inst.reset_instance();
+        wear_leveling_init();
+
+        // Random single byte writes, past the 2-byte optimised range, until the log is filled to the required level
+        std::size_t target = std::min<std::size_t>(LOG_SIZE * fill / 100, LOG_SIZE - 2 * sizeof(write_log_entry_t));
+        while (inst.total_write_count() * BACKING_STORE_WRITE_SIZE < target) {
+            uint32_t address = 64 + rng() % (WEAR_LEVELING_LOGICAL_SIZE - 64);
+            uint8_t  value   = rng() | 1;
+            wear_leveling_write(address, &value, sizeof(value));
+            verify_data[address] = value;
+        }
+
+        // Reads dominate init, each one being a flash access on hardware
+        uint64_t reads = inst.read_invoke_count();
+        measure_call("init " + std::to_string(fill) + "% full", 100, []() { wear_leveling_init(); });
+        reads = (inst.read_invoke_count() - reads) / 101;
+
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+        wear_leveling_read(0, readback.data(), readback.size());
+        EXPECT_TRUE(memcmp(readback.data(), verify_data.data(), readback.size()) == 0) << "Readback did not match";
+
+        std::fill(verify_data.begin(), verify_data.end(), 0);
+        printf("[ BENCH    ]   log %3d%% full: %6u backing reads\n", fill, (unsigned)reads);
+    }
+}
+
+/**
+ * Measures backing store writes per logical byte written, and the largest burst of writes made at once, for keymap-like
+ * workloads, with and without incremental consolidation.
+ */
+TEST_F(WearLevelingBenchmark, WriteAmplification) {
+    auto& inst = MockBackingStore::Instance();
+
+    struct workload_t {
+        const char* name;
+        void (*run)(workload_stats_t& stats, bool task);
+    };
+    static const workload_t workloads[] = {
+        {"single bytes",
+         [](workload_stats_t& stats, bool task) {
+             std::mt19937 rng(2);
+             for (int i = 0; i < 4000; ++i) {
+                 uint8_t value = rng();
+                 run_write(stats, task, rng() % WEAR_LEVELING_LOGICAL_SIZE, &value, sizeof(value));
+             }
+         }},
+        {"keycodes",
+         [](workload_stats_t& stats, bool task) {
+             std::mt19937 rng(3);
+             for (int i = 0; i < 4000; ++i) {
+                 uint16_t value = rng() % 0x100;
+                 run_write(stats, task, (rng() % KEYMAP_SIZE) & ~1, &value, sizeof(value));
+             }
+         }},
+        {"layer clears",
+         [](workload_stats_t& stats, bool task) {
+             std::array<uint16_t, KEYMAP_SIZE / 2 / 4> layer;
+             for (int i = 0; i < 400; ++i) {
+                 std::fill(layer.begin(), layer.end(), (i / 4) % 2); // KC_NO, then KC_TRANSPARENT
+                 run_write(stats, task, (i % 4) * sizeof(layer), layer.data(), sizeof(layer));
+             }
+         }},
+        {"keymap uploads",
+         [](workload_stats_t& stats, bool task) {
+             std::mt19937                         rng(4);
+             std::array<uint8_t, 28>              packet;
+             std::array<uint8_t, KEYMAP_SIZE / 2> keymap;
+             for (int i = 0; i < 20; ++i) {
+                 for (std::size_t k = 0; k < keymap.size(); k += 2) {
+                     keymap[k + 0] = rng() % 4 == 0 ? rng() : 0x01;
+                     keymap[k + 1] = 0x00;
+                 }
+                 for (std::size_t offset = 0; offset < keymap.size(); offset += packet.size()) {
+                     std::size_t length = std::min(packet.size(), keymap.size() - offset);
+                     run_write(stats, task, offset, &keymap[offset], length);
+                 }
+             }
+         }},
+    };
+
+    printf("[ BENCH    ] writes with %u byte logical size, %u byte write log, %u byte backing writes:\n", WEAR_LEVELING_LOGICAL_SIZE, LOG_SIZE, BACKING_STORE_WRITE_SIZE);
+    for (auto& workload : workloads) {
+        workload_stats_t blocking, incremental;
+
+        inst.reset_instance();
+        wear_leveling_init();
+        workload.run(blocking, false);
+        uint64_t blocking_bytes    = inst.total_write_count() * BACKING_STORE_WRITE_SIZE;
+        uint64_t blocking_erasures = inst.erase_invoke_count();
+
+        inst.reset_instance();
+        wear_leveling_init();
+        workload.run(incremental, true);
+        uint64_t incremental_bytes    = inst.total_write_count() * BACKING_STORE_WRITE_SIZE;
+        uint64_t incremental_erasures = inst.erase_invoke_count();
+
+        printf("[ BENCH    ]   %-14s %6u bytes: blocking %5.2fx %3u erases burst %4u | incremental %5.2fx %3u erases burst %4u\n", workload.name, (unsigned)blocking.logical_bytes, (double)blocking_bytes / blocking.logical_bytes, (unsigned)blocking_erasures, (unsigned)blocking.max_burst, (double)incremental_bytes / incremental.logical_bytes, (unsigned)incremental_erasures, (unsigned)incremental.max_burst);
+    }
+}
@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The encoders are shared by the ChibiOS SPI and PWM drivers, and only need the header
+COMMON_VPATH += $(PLATFORM_PATH)/chibios/drivers
@@ -0,0 +1,58 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The cost of turning a frame of LED colors into the waveform the SPI and PWM drivers send, against encoding bit by bit
+#include "test_common.hpp"
+#include "benchmark.hpp"
+
+typedef uint16_t ws2812_buffer_t;
+
+#define WS2812_DUTYCYCLE_0 29
+#define WS2812_DUTYCYCLE_1 75
+
+extern "C" {
+#include "ws2812_encoder.h"
+}
+
+#define LED_COUNT 64
+#define CHANNELS 3
+
+static void bit_by_bit_spi_encode(uint8_t *dest, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        for (int j = 0; j < 4; j++) {
+            uint8_t bits = data[i] >> (2 * (3 - j));
+            dest[4 * i + j] = ((bits & 0x02) ? 0b11100000 : 0b10000000) | ((bits & 0x01) ? 0b1110 : 0b1000);
+        }
+    }
+}
+
+static void bit_by_bit_pwm_encode(ws2812_buffer_t *dest, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            dest[8 * i + (7 - bit)] = ((data[i] >> bit) & 0x01) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0;
+        }
+    }
+}
+
+class Ws2812EncoderBenchmark : public Benchmark {
+   protected:
+    void SetUp() override {
+        for (size_t i = 0; i < sizeof(colors); i++) {
+            colors[i] = (uint8_t)(i * 37 + 11);
+        }
+    }
+
+    uint8_t         colors[LED_COUNT * CHANNELS];
+    uint8_t         spi[LED_COUNT * CHANNELS * WS2812_SPI_BYTES_PER_BYTE];
+    ws2812_buffer_t pwm[LED_COUNT * CHANNELS * 8];
+};
+
+TEST_F(Ws2812EncoderBenchmark, Spi) {
+    measure_call("spi frame, bit by bit", 10000, [&]() { bit_by_bit_spi_encode(spi, colors, sizeof(colors)); });
+    measure_call("spi frame", 10000, [&]() { ws2812_spi_encode(spi, colors, sizeof(colors)); });
+}
+
+TEST_F(Ws2812EncoderBenchmark, Pwm) {
+    measure_call("pwm frame, bit by bit", 10000, [&]() { bit_by_bit_pwm_encode(pwm, colors, sizeof(colors)); });
+    measure_call("pwm frame", 10000, [&]() { ws2812_pwm_encode(pwm, colors, sizeof(colors)); });
+}
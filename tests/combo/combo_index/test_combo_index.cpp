@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+
+static const uint16_t index_combo_counts[] = {10, 100, 500};
+static uint16_t       index_combo_count    = 0;
+
+extern "C" {
+void init_index_combos(void);
+void set_index_combo_keys(uint16_t combo_index, uint16_t first, uint16_t second);
+
+uint16_t combo_count(void) {
+    return index_combo_count;
+}
+}
+
+static void set_index_combo_count(uint16_t count) {
+    init_index_combos();
+    index_combo_count = count;
+}
+
+class ComboIndex : public TestFixture {};
+
+TEST_F(ComboIndex, combo_fires_regardless_of_combo_count) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 0, KC_J);
+    KeymapKey  key_k(0, 1, 0, KC_K);
+    set_keymap({key_j, key_k});
+
+    for (uint16_t count : index_combo_counts) {
+        set_index_combo_count(count);
+
+        EXPECT_REPORT(driver, (KC_B));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_combo({key_j, key_k});
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(ComboIndex, non_combo_key_passes_through) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 2, 0, KC_A);
+    set_keymap({key_a});
+
+    for (uint16_t count : index_combo_counts) {
+        set_index_combo_count(count);
+
+        EXPECT_REPORT(driver, (KC_A));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_key(key_a);
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(ComboIndex, changed_combo_keys_are_used_after_invalidation) {
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 0, KC_J);
+    KeymapKey  key_k(0, 1, 0, KC_K);
+    KeymapKey  key_l(0, 2, 0, KC_L);
+    set_keymap({key_j, key_k, key_l});
+    set_index_combo_count(10);
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_j, key_k});
+    VERIFY_AND_CLEAR(driver);
+
+    // Same number of combos, so only the invalidation tells the index to rebuild
+    set_index_combo_keys(0, KC_J, KC_L);
+    combo_index_invalidate();
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_j, key_l});
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,29 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#define INDEX_MAX_COMBOS 500
+
+// Combo 0 is J + K => B, every other combo is made of two keycodes that no
+// key in the test keymap produces, so they only add to the size of the index.
+// The number of combos in use is set by overriding combo_count().
+static uint16_t index_combo_keys[INDEX_MAX_COMBOS][3];
+
+combo_t key_combos[INDEX_MAX_COMBOS];
+
+void init_index_combos(void) {
+    for (uint16_t i = 0; i < INDEX_MAX_COMBOS; i++) {
+        index_combo_keys[i][0] = QK_UNICODE + 2 * i;
+        index_combo_keys[i][1] = QK_UNICODE + 2 * i + 1;
+        index_combo_keys[i][2] = COMBO_END;
+        key_combos[i]          = (combo_t)COMBO(index_combo_keys[i], KC_C);
+    }
+    index_combo_keys[0][0] = KC_J;
+    index_combo_keys[0][1] = KC_K;
+    key_combos[0].keycode  = KC_B;
+}
+
+void set_index_combo_keys(uint16_t combo_index, uint16_t first, uint16_t second) {
+    index_combo_keys[combo_index][0] = first;
+    index_combo_keys[combo_index][1] = second;
+}
@@ -0,0 +1,240 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct executed_t {
+    uintptr_t id;
+    uint32_t  trigger_time;
+    uint32_t  now;
+};
+
+static std::vector<executed_t> executed;
+static uint32_t                 repeat_delay = 0;
+
+static uint32_t record_callback(uint32_t trigger_time, void *cb_arg) {
+    executed.push_back({(uintptr_t)cb_arg, trigger_time, timer_read32()});
+    return repeat_delay;
+}
+
+class DeferredExec : public TestFixture {
+   protected:
+    static constexpr size_t table_count = 16;
+    deferred_executor_t table[table_count];
+    uint32_t            last_exec = 0;
+
+    DeferredExec() {
+        memset(table, 0, sizeof(table));
+        executed.clear();
+        repeat_delay = 0;
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id) {
+        return defer_exec_advanced(table, table_count, delay_ms, record_callback, (void *)id);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, table_count, &last_exec);
+        }
+    }
+
+    std::vector<uintptr_t> executed_ids() {
+        std::vector<uintptr_t> ids;
+        for (auto &e : executed) {
+            ids.push_back(e.id);
+        }
+        return ids;
+    }
+};
+
+TEST_F(DeferredExec, ExecutesInTriggerOrder) {
+    set_time(1000);
+    last_exec = 1000;
+    defer(30, 3);
+    defer(10, 1);
+    defer(20, 2);
+    defer(25, 4);
+
+    run_for(100);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{1, 2, 4, 3}));
+    for (auto &e : executed) {
+        EXPECT_EQ(e.trigger_time, e.now);
+    }
+}
+
+TEST_F(DeferredExec, DoesNotExecuteEarly) {
+    set_time(1000);
+    last_exec = 1000;
+    defer(50, 1);
+
+    run_for(49);
+    EXPECT_TRUE(executed.empty());
+    run_for(1);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{1}));
+}
+
+TEST_F(DeferredExec, RepeatsRelativeToPreviousTrigger) {
+    set_time(1000);
+    last_exec    = 1000;
+    repeat_delay = 10;
+    defer(10, 1);
+
+    run_for(35);
+    ASSERT_EQ(executed.size(), 3u);
+    EXPECT_EQ(executed[0].trigger_time, 1010u);
+    EXPECT_EQ(executed[1].trigger_time, 1020u);
+    EXPECT_EQ(executed[2].trigger_time, 1030u);
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    set_time(1000);
+    last_exec              = 1000;
+    deferred_token first   = defer(10, 1);
+    deferred_token second  = defer(20, 2);
+    deferred_token third   = defer(30, 3);
+    uint32_t       trigger = 0;
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, table_count, first));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, table_count, first));
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, table_count, second, 40));
+
+    ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger));
+    EXPECT_EQ(trigger, 1030u);
+
+    run_for(100);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{3, 2}));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, table_count, third, 10));
+    EXPECT_FALSE(deferred_exec_advanced_next_trigger(table, table_count, &trigger));
+}
+
+TEST_F(DeferredExec, RejectsWhenFull) {
+    set_time(1000);
+    last_exec = 1000;
+    for (size_t i = 0; i < table_count; i++) {
+        EXPECT_NE(defer(10 + i, i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(5, 99), INVALID_DEFERRED_TOKEN);
+
+    run_for(10);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{0}));
+    EXPECT_NE(defer(5, 99), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, WrapsAround32BitTimer) {
+    set_time(0xFFFFFFF0);
+    last_exec = 0xFFFFFFF0;
+    defer(0x20, 2); // triggers at 0x00000010, after wrapping
+    defer(0x08, 1); // triggers at 0xFFFFFFF8, before wrapping
+
+    uint32_t trigger = 0;
+    ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger));
+    EXPECT_EQ(trigger, 0xFFFFFFF8u);
+
+    run_for(0x08);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{1}));
+
+    ASSERT_TRUE(deferred_exec_advanced_next_trigger(table, table_count, &trigger));
+    EXPECT_EQ(trigger, 0x00000010u);
+
+    run_for(0x17);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{1}));
+    run_for(1);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{1, 2}));
+    EXPECT_EQ(executed[1].now, 0x00000010u);
+}
+
+TEST_F(DeferredExec, RepeatsAcrossTimerWraparound) {
+    set_time(0xFFFFFFE0);
+    last_exec    = 0xFFFFFFE0;
+    repeat_delay = 0x10;
+    defer(0x10, 1);
+    defer(0x18, 2);
+
+    run_for(0x40);
+    ASSERT_EQ(executed.size(), 7u);
+    for (size_t i = 1; i < executed.size(); i++) {
+        EXPECT_LE((int32_t)TIMER_DIFF_32(executed[i - 1].trigger_time, executed[i].trigger_time), 0);
+        EXPECT_EQ(executed[i].trigger_time, executed[i].now);
+    }
+}
+
+static deferred_executor_t *nested_table;
+static size_t               nested_table_count;
+static deferred_token       nested_cancel_token;
+
+static uint32_t nested_callback(uint32_t trigger_time, void *cb_arg) {
+    executed.push_back({(uintptr_t)cb_arg, trigger_time, timer_read32()});
+    cancel_deferred_exec_advanced(nested_table, nested_table_count, nested_cancel_token);
+    defer_exec_advanced(nested_table, nested_table_count, 5, record_callback, (void *)100);
+    return 0;
+}
+
+TEST_F(DeferredExec, CallbackCanModifyTable) {
+    set_time(1000);
+    last_exec          = 1000;
+    nested_table       = table;
+    nested_table_count = table_count;
+    defer_exec_advanced(table, table_count, 10, nested_callback, (void *)1);
+    nested_cancel_token = defer(12, 2);
+    defer(14, 3);
+
+    run_for(100);
+    EXPECT_EQ(executed_ids(), (std::vector<uintptr_t>{1, 3, 100}));
+}
+
+TEST_F(DeferredExec, ManyExecutorsRunOnceInOrder) {
+    set_time(0xFFFFFF00);
+    last_exec = 0xFFFFFF00;
+    srand(1234);
+    for (size_t i = 0; i < table_count; i++) {
+        defer(1 + (rand() % 500), i);
+    }
+
+    run_for(600);
+    ASSERT_EQ(executed.size(), (size_t)table_count);
+    std::vector<uintptr_t> ids = executed_ids();
+    std::sort(ids.begin(), ids.end());
+    for (size_t i = 0; i < table_count; i++) {
+        EXPECT_EQ(ids[i], i);
+    }
+    for (size_t i = 1; i < executed.size(); i++) {
+        EXPECT_LE((int32_t)TIMER_DIFF_32(executed[i - 1].trigger_time, executed[i].trigger_time), 0);
+    }
+}
+
+TEST_F(DeferredExec, BasicApiReportsNextTrigger) {
+    set_time(1000);
+    uint32_t trigger = 0;
+    EXPECT_FALSE(deferred_exec_next_trigger(&trigger));
+
+    deferred_token token = defer_exec(20, record_callback, (void *)1);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+    ASSERT_TRUE(deferred_exec_next_trigger(&trigger));
+    EXPECT_EQ(trigger, 1020u);
+
+    EXPECT_TRUE(cancel_deferred_exec(token));
+    EXPECT_FALSE(deferred_exec_next_trigger(&trigger));
+}
+
+TEST_F(DeferredExec, BasicApiHoldsSixteenExecutors) {
+    set_time(1000);
+    std::vector<deferred_token> tokens;
+    for (uintptr_t i = 0; i < 16; i++) {
+        deferred_token token = defer_exec(10 + i, record_callback, (void *)i);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        tokens.push_back(token);
+    }
+
+    for (auto token : tokens) {
+        EXPECT_TRUE(cancel_deferred_exec(token));
+    }
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define DYNAMIC_KEYMAP_LAYER_COUNT 2
+#define DYNAMIC_KEYMAP_RAM_CACHE
+#define EEPROM_SIZE 512
+#define DYNAMIC_KEYMAP_STREAM_BUFFER_SIZE 32
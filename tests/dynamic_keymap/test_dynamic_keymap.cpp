@@ -0,0 +1,157 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+#include "nvm_dynamic_keymap.h"
+#include "eeprom.h"
+}
+
+class DynamicKeymap : public TestFixture {
+   protected:
+    void clear_buffer(uint16_t size) {
+        uint8_t zeros[size];
+        memset(zeros, 0, size);
+        dynamic_keymap_set_buffer(0, size, zeros);
+    }
+
+    // Locate the first key of the dynamic keymap in EEPROM by its contents
+    uint8_t *keymap_eeprom_address(void) {
+        dynamic_keymap_set_keycode(0, 0, 0, 0xA55A);
+        for (uintptr_t offset = 0; offset < TOTAL_EEPROM_BYTE_COUNT - 1; offset++) {
+            uint8_t *address = (uint8_t *)offset;
+            if (eeprom_read_byte(address) == 0xA5 && eeprom_read_byte(address + 1) == 0x5A) {
+                return address;
+            }
+        }
+        ADD_FAILURE() << "Dynamic keymap not found in EEPROM";
+        return NULL;
+    }
+};
+
+TEST_F(DynamicKeymap, SetKeycodeReadsBack) {
+    dynamic_keymap_set_keycode(1, 2, 3, 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), 0x1234);
+    EXPECT_EQ(keycode_at_keymap_location(1, 2, 3), 0x1234);
+}
+
+TEST_F(DynamicKeymap, SetKeycodeWritesThrough) {
+    uint8_t *address = keymap_eeprom_address();
+    dynamic_keymap_set_keycode(0, 0, 0, 0xABCD);
+
+    // Big endian in EEPROM, as the host tools expect
+    EXPECT_EQ(eeprom_read_byte(address), 0xAB);
+    EXPECT_EQ(eeprom_read_byte(address + 1), 0xCD);
+
+    // Still there when reloaded from EEPROM
+    nvm_dynamic_keymap_erase();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0xABCD);
+}
+
+TEST_F(DynamicKeymap, LookupsServedFromRam) {
+    uint8_t *address = keymap_eeprom_address();
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+
+    // Changing EEPROM behind the keymap's back is only seen after a reload
+    eeprom_update_byte(address + 1, KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_A);
+
+    nvm_dynamic_keymap_erase();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_B);
+}
+
+TEST_F(DynamicKeymap, SetBufferUpdatesKeycodes) {
+    uint8_t data[] = {0x12, 0x34, 0x56, 0x78};
+
+    dynamic_keymap_set_buffer(MATRIX_COLS * 2, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), 0x5678);
+
+    nvm_dynamic_keymap_erase();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 1), 0x5678);
+}
+
+TEST_F(DynamicKeymap, SetKeycodeUpdatesBuffer) {
+    uint8_t data[2] = {0};
+
+    dynamic_keymap_set_keycode(1, 3, 9, 0x4321);
+    dynamic_keymap_get_buffer(((1 * MATRIX_ROWS + 3) * MATRIX_COLS + 9) * 2, sizeof(data), data);
+    EXPECT_EQ(data[0], 0x43);
+    EXPECT_EQ(data[1], 0x21);
+}
+
+TEST_F(DynamicKeymap, BufferPastKeymapIgnored) {
+    uint16_t keymap_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+    uint8_t  data[4]     = {0x11, 0x22, 0x33, 0x44};
+
+    dynamic_keymap_set_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1, KC_Z);
+    dynamic_keymap_set_buffer(keymap_size - 2, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), 0x1122);
+
+    dynamic_keymap_get_buffer(keymap_size - 2, sizeof(data), data);
+    EXPECT_EQ(data[0], 0x11);
+    EXPECT_EQ(data[1], 0x22);
+    EXPECT_EQ(data[2], 0x00);
+    EXPECT_EQ(data[3], 0x00);
+}
+
+TEST_F(DynamicKeymap, OutOfRangeIsNoKey) {
+    EXPECT_EQ(keycode_at_keymap_location(DYNAMIC_KEYMAP_LAYER_COUNT, 0, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, MATRIX_COLS), KC_NO);
+}
+
+TEST_F(DynamicKeymap, StreamWrittenOnCommit) {
+    uint8_t *address = keymap_eeprom_address();
+    uint8_t  data[]  = {0x12, 0x34, 0x56, 0x78};
+
+    dynamic_keymap_stream_buffer(0, sizeof(data), data);
+    EXPECT_EQ(eeprom_read_byte(address), 0xA5);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0xA55A);
+
+    dynamic_keymap_stream_commit();
+    EXPECT_EQ(eeprom_read_byte(address), 0x12);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), 0x5678);
+}
+
+TEST_F(DynamicKeymap, StreamWrittenWhenBufferFills) {
+    uint8_t data[28];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i + 1;
+    }
+    clear_buffer(sizeof(data) * 2);
+
+    // The second packet fills the stream buffer part way through
+    dynamic_keymap_stream_buffer(0, sizeof(data), data);
+    dynamic_keymap_stream_buffer(sizeof(data), sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 3), (27 << 8) | 28);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 5), (3 << 8) | 4);
+
+    // The rest waits for the commit
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 6), KC_NO);
+    dynamic_keymap_stream_commit();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 6), (5 << 8) | 6);
+}
+
+TEST_F(DynamicKeymap, StreamCommittedByOtherAccesses) {
+    uint8_t data[]      = {0x12, 0x34};
+    uint8_t other[]     = {0x56, 0x78};
+    uint8_t readback[2] = {0};
+    clear_buffer(MATRIX_COLS * 2 + sizeof(other));
+
+    // A write elsewhere writes what was staged first
+    dynamic_keymap_stream_buffer(0, sizeof(data), data);
+    dynamic_keymap_stream_buffer(MATRIX_COLS * 2, sizeof(other), other);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 1, 0), KC_NO);
+
+    // And so does reading the buffer back
+    dynamic_keymap_get_buffer(MATRIX_COLS * 2, sizeof(readback), readback);
+    EXPECT_EQ(readback[0], 0x56);
+    EXPECT_EQ(readback[1], 0x78);
+}
@@ -0,0 +1,24 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+}
+
+// Without VIA there is no stream buffer, unless one is configured
+class UnbufferedStream : public TestFixture {};
+
+TEST_F(UnbufferedStream, WrittenStraightAway) {
+    uint8_t data[] = {0x12, 0x34, 0x56, 0x78};
+
+    dynamic_keymap_stream_buffer(0, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), 0x5678);
+
+    // Nothing left to commit
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+    dynamic_keymap_stream_commit();
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_A);
+}
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EECONFIG_WRITE_BACK
+#define EECONFIG_WRITE_BACK_CHUNK_SIZE 1
+#define EECONFIG_WRITE_BACK_IDLE_TIME 250
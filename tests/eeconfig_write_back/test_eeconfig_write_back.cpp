@@ -0,0 +1,131 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "eeprom.h"
+}
+
+using testing::_;
+
+class EeconfigWriteBack : public TestFixture {
+   protected:
+    void SetUp() override {
+        // Locate the user config in EEPROM by its contents
+        eeconfig_update_user(0xA5C3E1F0);
+        eeconfig_flush();
+        for (uintptr_t offset = 0; offset < TOTAL_EEPROM_BYTE_COUNT - 3; offset++) {
+            if (eeprom_read_dword((uint32_t *)offset) == 0xA5C3E1F0) {
+                user_address = (uint32_t *)offset;
+                return;
+            }
+        }
+        FAIL() << "User config not found in EEPROM";
+    }
+
+    // What has actually been written back
+    uint32_t stored_user(void) {
+        return eeprom_read_dword(user_address);
+    }
+
+    uint32_t *user_address;
+};
+
+TEST_F(EeconfigWriteBack, UpdateReadsBackBeforeWriteBack) {
+    TestDriver driver;
+    uint32_t   stored = stored_user();
+
+    eeconfig_update_user(stored + 1);
+    EXPECT_EQ(eeconfig_read_user(), stored + 1);
+    EXPECT_EQ(stored_user(), stored);
+
+    eeconfig_flush();
+    EXPECT_EQ(stored_user(), stored + 1);
+}
+
+TEST_F(EeconfigWriteBack, WrittenBackOnceIdle) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(2);
+    tap_key(key);
+
+    eeconfig_update_user(0x12345678);
+    idle_for(EECONFIG_WRITE_BACK_IDLE_TIME / 2);
+    EXPECT_NE(stored_user(), 0x12345678);
+
+    idle_for(EECONFIG_WRITE_BACK_IDLE_TIME);
+    EXPECT_EQ(stored_user(), 0x12345678);
+}
+
+TEST_F(EeconfigWriteBack, TypingDefersWriteBack) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(20);
+
+    eeconfig_update_user(0xCAFEF00D);
+    for (int i = 0; i < 10; i++) {
+        tap_key(key);
+        idle_for(EECONFIG_WRITE_BACK_IDLE_TIME / 2);
+    }
+    EXPECT_NE(stored_user(), 0xCAFEF00D);
+
+    idle_for(EECONFIG_WRITE_BACK_IDLE_TIME);
+    EXPECT_EQ(stored_user(), 0xCAFEF00D);
+}
+
+TEST_F(EeconfigWriteBack, RepeatedUpdatesCoalesce) {
+    TestDriver driver;
+
+    // Like holding a hue key: only the last value is written back
+    for (uint32_t hue = 0; hue < 100; hue++) {
+        eeconfig_update_user(hue);
+        run_one_scan_loop();
+        EXPECT_NE(stored_user(), hue);
+    }
+
+    eeconfig_flush();
+    EXPECT_EQ(stored_user(), 99);
+}
+
+TEST_F(EeconfigWriteBack, WrittenBackOneChunkAtATime) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(2);
+    tap_key(key);
+
+    // A chunk of EECONFIG_WRITE_BACK_CHUNK_SIZE per loop, so a byte at a time
+    eeconfig_update_user(0x11223344);
+    idle_for(EECONFIG_WRITE_BACK_IDLE_TIME);
+    EXPECT_EQ(stored_user(), 0xA5C3E144);
+
+    run_one_scan_loop();
+    EXPECT_EQ(stored_user(), 0xA5C33344);
+
+    idle_for(2);
+    EXPECT_EQ(stored_user(), 0x11223344);
+}
+
+TEST_F(EeconfigWriteBack, FlushedOnSuspend) {
+    TestDriver driver;
+
+    eeconfig_update_user(0x0BADCAFE);
+    suspend_power_down_quantum();
+    EXPECT_EQ(stored_user(), 0x0BADCAFE);
+}
+
+TEST_F(EeconfigWriteBack, InitIsWrittenAtOnce) {
+    TestDriver driver;
+
+    eeconfig_update_user(0x12345678);
+    eeconfig_init();
+    EXPECT_EQ(eeconfig_read_user(), 0);
+    EXPECT_EQ(stored_user(), 0);
+}
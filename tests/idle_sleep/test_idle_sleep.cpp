@@ -0,0 +1,144 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+
+static bool sleep_allowed = true;
+
+extern "C" {
+bool idle_sleep_allowed_user(void) {
+    return sleep_allowed;
+}
+
+static uint32_t noop_callback(uint32_t trigger_time, void *cb_arg) {
+    return 0;
+}
+
+// The test matrix has no select lines, so it can always be armed
+bool matrix_idle_arm(void) {
+    return true;
+}
+
+void advance_time(uint32_t ms);
+}
+
+class IdleSleep : public TestFixture {
+   protected:
+    IdleSleep() {
+        sleep_allowed = true;
+    }
+
+    // One pass of the main loop, ending with the sleep. The test platform lets the whole sleep time pass.
+    void run_main_loop() {
+        run_keyboard_task();
+        keyboard_idle_sleep_task();
+        advance_time(1);
+    }
+};
+
+TEST_F(IdleSleep, SleepsForTimeoutWhenIdle) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_idle_sleep_time(), 50u);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSleep, StaysAwakeWhileKeyHeld) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_idle_sleep_time(), 0u);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_idle_sleep_time(), 50u);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSleep, WakesForPendingTap) {
+    TestDriver driver;
+    KeymapKey  mod_tap(0, 1, 0, SFT_T(KC_P));
+    set_keymap({mod_tap});
+
+    // The tap stays pending after release in case it turns into a double tap
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(mod_tap);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(TAPPING_TERM - 20);
+    uint32_t sleep_time = keyboard_idle_sleep_time();
+    EXPECT_GT(sleep_time, 0u);
+    EXPECT_LE(sleep_time, 20u);
+
+    // Once the tapping term is up the next tick has to run to resolve the tap
+    idle_for(sleep_time);
+    EXPECT_EQ(keyboard_idle_sleep_time(), 0u);
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_idle_sleep_time(), 50u);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSleep, WakesForDeferredExecutor) {
+    TestDriver     driver;
+    deferred_token token = defer_exec(10, noop_callback, NULL);
+    ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+
+    EXPECT_EQ(keyboard_idle_sleep_time(), 10u);
+    idle_for(4);
+    EXPECT_EQ(keyboard_idle_sleep_time(), 6u);
+
+    cancel_deferred_exec(token);
+    EXPECT_EQ(keyboard_idle_sleep_time(), 50u);
+}
+
+TEST_F(IdleSleep, UserCanPreventSleep) {
+    TestDriver driver;
+    sleep_allowed = false;
+    EXPECT_EQ(keyboard_idle_sleep_time(), 0u);
+}
+
+TEST_F(IdleSleep, KeyPressedWhileAsleepIsSeenWithinTimeout) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_NO_REPORT(driver);
+    uint32_t asleep_at = timer_read32();
+    run_main_loop();
+    EXPECT_GE(timer_elapsed32(asleep_at), MATRIX_IDLE_SLEEP_TIMEOUT);
+    VERIFY_AND_CLEAR(driver);
+
+    // The key goes down at the start of the sleep, the worst case, and is reported by the very next pass
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_main_loop();
+    EXPECT_LE(timer_elapsed32(asleep_at), MATRIX_IDLE_SLEEP_TIMEOUT + 2);
+    VERIFY_AND_CLEAR(driver);
+
+    // Nothing sleeps while the key is held, so the release is seen on the next pass
+    EXPECT_NO_REPORT(driver);
+    uint32_t held_at = timer_read32();
+    run_main_loop();
+    EXPECT_EQ(timer_elapsed32(held_at), 1u);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_main_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define MATRIX_IDLE_SLEEP
+#define MATRIX_IDLE_SLEEP_TIMEOUT 50
+
+#define NUM_ENCODERS 1
@@ -0,0 +1,79 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+
+static int8_t   pending_steps = 0;
+static uint32_t steps_seen    = 0;
+
+extern "C" {
+// The test matrix has no select lines, so it can always be armed
+bool matrix_idle_arm(void) {
+    return true;
+}
+
+// An encoder that is polled like the quadrature driver, without a wake interrupt
+void encoder_driver_init(void) {}
+
+void encoder_driver_task(void) {
+    for (; pending_steps > 0; pending_steps--) {
+        encoder_queue_event(0, true);
+    }
+}
+
+bool encoder_update_user(uint8_t index, bool clockwise) {
+    steps_seen++;
+    return false;
+}
+
+void advance_time(uint32_t ms);
+}
+
+class IdleSleepEncoder : public TestFixture {
+   protected:
+    IdleSleepEncoder() {
+        pending_steps = 0;
+        steps_seen    = 0;
+    }
+
+    // One pass of the main loop, ending with the sleep. The test platform lets the whole sleep time pass.
+    void run_main_loop() {
+        run_keyboard_task();
+        keyboard_idle_sleep_task();
+        advance_time(1);
+    }
+};
+
+TEST_F(IdleSleepEncoder, NeverSleeps) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_idle_sleep_time(), 0u);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(IdleSleepEncoder, StepWhileIdleIsSeenOnNextPass) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    for (int i = 0; i < 10; i++) {
+        run_main_loop();
+    }
+
+    uint32_t stepped_at = timer_read32();
+    pending_steps       = 1;
+    run_main_loop();
+    EXPECT_EQ(steps_seen, 1u);
+    EXPECT_LE(timer_elapsed32(stepped_at), 1u);
+
+    // Every step of a fast turn is seen, one per pass
+    for (int i = 0; i < 5; i++) {
+        pending_steps = 1;
+        run_main_loop();
+    }
+    EXPECT_EQ(steps_seen, 6u);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,119 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+static const uint16_t index_key_override_counts[] = {10, 50, 200};
+static uint16_t       index_key_override_count    = 0;
+
+extern "C" {
+void init_index_key_overrides(uint16_t count);
+void set_index_key_override_trigger(uint16_t override_index, uint16_t trigger);
+
+uint16_t key_override_count(void) {
+    return index_key_override_count;
+}
+}
+
+static void set_index_key_override_count(uint16_t count) {
+    init_index_key_overrides(count);
+    index_key_override_count = count;
+}
+
+class KeyOverrideIndex : public TestFixture {};
+
+TEST_F(KeyOverrideIndex, override_fires_regardless_of_override_count) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_esc(0, 1, 0, KC_ESC);
+    set_keymap({key_shift, key_esc});
+
+    for (uint16_t count : index_key_override_counts) {
+        set_index_key_override_count(count);
+
+        EXPECT_REPORT(driver, (KC_LSFT));
+        key_shift.press();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_REPORT(driver, (KC_HOME));
+        key_esc.press();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_REPORT(driver, (KC_LSFT));
+        key_esc.release();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_EMPTY_REPORT(driver);
+        key_shift.release();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(KeyOverrideIndex, non_trigger_key_passes_through) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 2, 0, KC_A);
+    set_keymap({key_shift, key_a});
+
+    for (uint16_t count : index_key_override_counts) {
+        set_index_key_override_count(count);
+
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_REPORT(driver, (KC_LSFT, KC_A));
+        EXPECT_REPORT(driver, (KC_LSFT));
+        EXPECT_EMPTY_REPORT(driver);
+        key_shift.press();
+        run_one_scan_loop();
+        tap_key(key_a);
+        key_shift.release();
+        run_one_scan_loop();
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(KeyOverrideIndex, changed_trigger_is_used_after_invalidation) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_shift(0, 0, 0, KC_LSFT);
+    KeymapKey  key_a(0, 2, 0, KC_A);
+    set_keymap({key_shift, key_a});
+    set_index_key_override_count(10);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+
+    // Same number of overrides, so only the invalidation tells the index to rebuild
+    set_index_key_override_trigger(9, KC_A);
+    key_override_index_invalidate();
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_shift.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_HOME));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_shift.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,25 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+#define INDEX_MAX_KEY_OVERRIDES 200
+
+// The last override in use is Shift + Esc => Home, every other override is
+// Shift + a keycode that no key in the test keymap produces, so they only add
+// to the size of the index. The number of overrides in use is set by
+// overriding key_override_count().
+static key_override_t index_key_overrides[INDEX_MAX_KEY_OVERRIDES];
+
+const key_override_t *key_overrides[INDEX_MAX_KEY_OVERRIDES];
+
+void init_index_key_overrides(uint16_t count) {
+    for (uint16_t i = 0; i < INDEX_MAX_KEY_OVERRIDES; i++) {
+        index_key_overrides[i] = (key_override_t)ko_make_basic(MOD_MASK_SHIFT, QK_UNICODE + i, KC_C);
+        key_overrides[i]       = &index_key_overrides[i];
+    }
+    index_key_overrides[count - 1] = (key_override_t)ko_make_basic(MOD_MASK_SHIFT, KC_ESC, KC_HOME);
+}
+
+void set_index_key_override_trigger(uint16_t override_index, uint16_t trigger) {
+    index_key_overrides[override_index].trigger = trigger;
+}
@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+LATENCY_TRACE_ENABLE = yes
+AUTO_SHIFT_ENABLE = yes
@@ -0,0 +1,64 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyAutoShift : public TestFixture {};
+
+TEST_F(LatencyAutoShift, TapWaitsForRelease) {
+    TestDriver driver;
+    InSequence s;
+    auto       regular_key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key, 40);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(regular_key, true, 40);
+    expect_latency(regular_key, false, 0);
+}
+
+TEST_F(LatencyAutoShift, HoldWaitsForTimeout) {
+    TestDriver driver;
+    InSequence s;
+    auto       regular_key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT, KC_A));
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.press();
+    idle_for(AUTO_SHIFT_TIMEOUT + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(regular_key, true, AUTO_SHIFT_TIMEOUT);
+
+    EXPECT_NO_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyAutoShift, NonShiftableKeyIsImmediate) {
+    TestDriver driver;
+    InSequence s;
+    auto       arrow_key = KeymapKey(0, 1, 0, KC_LEFT);
+
+    set_keymap({arrow_key});
+
+    EXPECT_REPORT(driver, (KC_LEFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(arrow_key, 40);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(arrow_key, true, 0);
+    expect_latency(arrow_key, false, 0);
+}
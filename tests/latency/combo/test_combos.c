@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { space };
+
+uint16_t const space_combo[] = {KC_J, KC_K, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [space] = COMBO(space_combo, KC_SPACE),
+};
+// clang-format on
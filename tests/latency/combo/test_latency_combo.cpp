@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyCombo : public TestFixture {};
+
+TEST_F(LatencyCombo, ComboWaitsForComboTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_j = KeymapKey(0, 1, 0, KC_J);
+    auto       key_k = KeymapKey(0, 2, 0, KC_K);
+
+    set_keymap({key_j, key_k});
+    // A combo timer started at 0ms reads as not running
+    idle_for(1);
+
+    EXPECT_NO_REPORT(driver);
+    key_j.press();
+    idle_for(10);
+    key_k.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // A complete combo still waits in case a longer one is being pressed
+    EXPECT_REPORT(driver, (KC_SPACE));
+    idle_for(COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(key_j, true, 10 + COMBO_TERM + 1);
+    expect_latency(key_k, true, COMBO_TERM + 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_j.release();
+    key_k.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LatencyCombo, ComboKeyAloneWaitsForComboTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_j = KeymapKey(0, 1, 0, KC_J);
+    auto       key_k = KeymapKey(0, 2, 0, KC_K);
+
+    set_keymap({key_j, key_k});
+    // A combo timer started at 0ms reads as not running
+    idle_for(1);
+
+    EXPECT_REPORT(driver, (KC_J));
+    key_j.press();
+    idle_for(COMBO_TERM + 2);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(key_j, true, COMBO_TERM + 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_j.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(key_j, false, 0);
+}
+
+TEST_F(LatencyCombo, OtherKeysAreImmediate) {
+    TestDriver driver;
+    InSequence s;
+    auto       regular_key = KeymapKey(0, 3, 0, KC_A);
+
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(regular_key, true, 0);
+    expect_latency(regular_key, false, 0);
+}
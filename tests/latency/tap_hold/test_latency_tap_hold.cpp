@@ -0,0 +1,101 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "latency_trace.h"
+}
+
+using testing::_;
+using testing::InSequence;
+
+class LatencyTapHold : public TestFixture {};
+
+TEST_F(LatencyTapHold, RegularKeyIsImmediate) {
+    TestDriver driver;
+    InSequence s;
+    auto       regular_key = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({regular_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(regular_key, 30);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(regular_key, true, 0);
+    expect_latency(regular_key, false, 0);
+}
+
+TEST_F(LatencyTapHold, TapWaitsForRelease) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(mod_tap_key, 50);
+    VERIFY_AND_CLEAR(driver);
+
+    // The tap is only known once the key is released
+    expect_latency(mod_tap_key, true, 50);
+    expect_latency(mod_tap_key, false, 0);
+    EXPECT_EQ(latency_trace_latency(latency_trace_find(mod_tap_key.position, true), LATENCY_STAGE_ACTION), 0);
+}
+
+TEST_F(LatencyTapHold, HoldWaitsForTappingTerm) {
+    TestDriver driver;
+    InSequence s;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, SFT_T(KC_P));
+
+    set_keymap({mod_tap_key});
+
+    EXPECT_REPORT(driver, (KC_LEFT_SHIFT));
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(mod_tap_key, true, TAPPING_TERM);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(mod_tap_key, false, 0);
+}
+
+TEST_F(LatencyTapHold, KeyWithoutReportIsNotCharged) {
+    TestDriver driver;
+    InSequence s;
+    auto       layer_key   = KeymapKey(0, 1, 0, MO(1));
+    auto       regular_key = KeymapKey(0, 2, 0, KC_A);
+    auto       layer_1_key = KeymapKey(1, 2, 0, KC_B);
+
+    set_keymap({layer_key, regular_key, layer_1_key});
+
+    layer_key.press();
+    run_one_scan_loop();
+
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(20);
+    tap_key(regular_key);
+    VERIFY_AND_CLEAR(driver);
+
+    expect_latency(regular_key, true, 0);
+
+    layer_key.release();
+    run_one_scan_loop();
+
+    // The layer change never reached the host
+    const latency_trace_t *trace = latency_trace_find(layer_key.position, true);
+    ASSERT_NE(trace, nullptr);
+    EXPECT_FALSE(trace->open);
+    EXPECT_EQ(latency_trace_latency(trace, LATENCY_STAGE_PROCESS), 0);
+    EXPECT_EQ(latency_trace_latency(trace, LATENCY_STAGE_REPORT), UINT32_MAX);
+}
@@ -0,0 +1,15 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_MOTION_INTERRUPT
+#define POINTING_DEVICE_MOTION_PIN 0
+#define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+#define POINTING_DEVICE_TASK_THROTTLE_MS 8
+
+// There is no GPIO on the test platform, the motion pin is left inactive so only the interrupt triggers reads
+#define gpio_set_pin_input_high(pin)
+#define gpio_read_pin(pin) 1
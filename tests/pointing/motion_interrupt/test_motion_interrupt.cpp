@@ -0,0 +1,121 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+class PointingMotionInterrupt : public TestFixture {
+   protected:
+    void TearDown() override {
+        // Drain whatever is left, so the next test starts with nothing accumulated
+        {
+            TestDriver driver;
+            EXPECT_CALL(driver, send_mouse_mock(_)).Times(testing::AnyNumber());
+            pd_clear_movement();
+            pd_clear_all_buttons();
+            pointing_device_motion_interrupt();
+            idle_for(POINTING_DEVICE_TASK_THROTTLE_MS * 2);
+        }
+        TestFixture::TearDown();
+    }
+
+    /* Collects every mouse report sent by the driver, as the phase of the throttle is not known. */
+    void capture_reports(TestDriver &driver) {
+        EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly([this](report_mouse_t &report) { reports.push_back(report); });
+    }
+
+    std::vector<report_mouse_t> reports;
+};
+
+TEST_F(PointingMotionInterrupt, NoReadWithoutMotion) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    pointing_device_motion_interrupt();
+    EXPECT_MOUSE_REPORT(driver, (10, 0, 0, 0, 0));
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    // The interrupt is consumed by the read
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingMotionInterrupt, ReadsAreCoalescedIntoOneReportPerPeriod) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    pd_set_x(5);
+    pd_set_y(-3);
+    pd_set_v(1);
+    for (int i = 0; i < POINTING_DEVICE_TASK_THROTTLE_MS * 4; i++) {
+        pointing_device_motion_interrupt();
+        run_one_scan_loop();
+    }
+    pd_clear_movement();
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    // Every loop read the sensor, but at most one report was sent per period
+    int32_t x = 0, y = 0, v = 0;
+    for (auto &report : reports) {
+        x += report.x;
+        y += report.y;
+        v += report.v;
+    }
+    EXPECT_GE(reports.size(), 4);
+    EXPECT_LE(reports.size(), 5);
+    EXPECT_EQ(x, 5 * POINTING_DEVICE_TASK_THROTTLE_MS * 4);
+    EXPECT_EQ(y, -3 * POINTING_DEVICE_TASK_THROTTLE_MS * 4);
+    EXPECT_EQ(v, POINTING_DEVICE_TASK_THROTTLE_MS * 4);
+}
+
+TEST_F(PointingMotionInterrupt, MovementBeyondReportRangeIsCarriedOver) {
+    TestDriver driver;
+    capture_reports(driver);
+
+    pd_set_x(100);
+    pd_set_y(-100);
+    for (int i = 0; i < 3; i++) {
+        pointing_device_motion_interrupt();
+        run_one_scan_loop();
+    }
+    pd_clear_movement();
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS * 3);
+    VERIFY_AND_CLEAR(driver);
+
+    int32_t x = 0, y = 0;
+    for (auto &report : reports) {
+        x += report.x;
+        y += report.y;
+    }
+    EXPECT_GE(reports.size(), 3);
+    EXPECT_EQ(x, 300);
+    EXPECT_EQ(y, -300);
+}
+
+TEST_F(PointingMotionInterrupt, ButtonsFollowTheSensor) {
+    TestDriver driver;
+
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    pointing_device_motion_interrupt();
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS);
+    VERIFY_AND_CLEAR(driver);
+
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    pointing_device_motion_interrupt();
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_TASK_THROTTLE_MS);
+    VERIFY_AND_CLEAR(driver);
+}
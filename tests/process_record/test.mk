@@ -0,0 +1,48 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+AUTOCORRECT_ENABLE = yes
+CAPS_WORD_ENABLE = yes
+DYNAMIC_MACRO_ENABLE = yes
+DYNAMIC_TAPPING_TERM_ENABLE = yes
+KEY_LOCK_ENABLE = yes
+KEY_OVERRIDE_ENABLE = yes
+LAYER_LOCK_ENABLE = yes
+LEADER_ENABLE = yes
+PROGRAMMABLE_BUTTON_ENABLE = yes
+REPEAT_KEY_ENABLE = yes
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+SECURE_ENABLE = yes
+TAP_DANCE_ENABLE = yes
+TRI_LAYER_ENABLE = yes
+UNICODE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = test_process_record_keymap.c
+
+# Record every call from process_record_quantum() into the handlers, see test_process_record.cpp
+PROCESS_RECORD_WRAPPED = \
+	process_key_lock \
+	process_dynamic_macro \
+	process_last_key \
+	process_repeat_key \
+	process_secure \
+	process_caps_word \
+	process_key_override \
+	process_tap_dance \
+	process_unicode_common \
+	process_leader \
+	process_dynamic_tapping_term \
+	process_magic \
+	process_grave_esc \
+	process_underglow \
+	process_rgb_matrix \
+	process_programmable_button \
+	process_autocorrect \
+	process_tri_layer \
+	process_default_layer \
+	process_layer_lock \
+	process_oneshot \
+	process_quantum
+
+LDFLAGS += $(foreach handler,$(PROCESS_RECORD_WRAPPED),-Wl,--wrap=$(handler))
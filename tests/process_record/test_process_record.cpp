@@ -0,0 +1,183 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+// The handlers are wrapped at link time in test.mk, so every call made by process_record_quantum() is recorded here
+static std::vector<std::string> calls;
+
+#define RECORD_HANDLER(handler)                                   \
+    bool __real_##handler(uint16_t keycode, keyrecord_t *record); \
+    bool __wrap_##handler(uint16_t keycode, keyrecord_t *record) { \
+        calls.push_back(#handler);                                \
+        return __real_##handler(keycode, record);                 \
+    }
+
+extern "C" {
+bool __real_process_key_lock(uint16_t *keycode, keyrecord_t *record);
+bool __wrap_process_key_lock(uint16_t *keycode, keyrecord_t *record) {
+    calls.push_back("process_key_lock");
+    return __real_process_key_lock(keycode, record);
+}
+
+RECORD_HANDLER(process_dynamic_macro)
+RECORD_HANDLER(process_last_key)
+RECORD_HANDLER(process_repeat_key)
+RECORD_HANDLER(process_secure)
+RECORD_HANDLER(process_caps_word)
+RECORD_HANDLER(process_key_override)
+RECORD_HANDLER(process_tap_dance)
+RECORD_HANDLER(process_unicode_common)
+RECORD_HANDLER(process_leader)
+RECORD_HANDLER(process_dynamic_tapping_term)
+RECORD_HANDLER(process_magic)
+RECORD_HANDLER(process_grave_esc)
+RECORD_HANDLER(process_underglow)
+RECORD_HANDLER(process_rgb_matrix)
+RECORD_HANDLER(process_programmable_button)
+RECORD_HANDLER(process_autocorrect)
+RECORD_HANDLER(process_tri_layer)
+RECORD_HANDLER(process_default_layer)
+RECORD_HANDLER(process_layer_lock)
+RECORD_HANDLER(process_oneshot)
+RECORD_HANDLER(process_quantum)
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    calls.push_back("process_record_user");
+    return true;
+}
+}
+
+typedef struct {
+    const char *name;
+    uint16_t    first;
+    uint16_t    last;
+} handler_t;
+
+// The documented order of process_record_quantum(), with the keycodes each enabled handler can act on
+static const handler_t handler_order[] = {
+    {"process_key_lock", 0, UINT16_MAX},
+    {"process_dynamic_macro", 0, UINT16_MAX},
+    {"process_last_key", 0, UINT16_MAX},
+    {"process_repeat_key", 0, UINT16_MAX},
+    {"process_record_user", 0, UINT16_MAX},
+    {"process_secure", QK_SECURE_LOCK, QK_SECURE_REQUEST},
+    {"process_caps_word", 0, UINT16_MAX},
+    {"process_key_override", 0, UINT16_MAX},
+    {"process_tap_dance", 0, UINT16_MAX},
+    {"process_unicode_common", 0, UINT16_MAX},
+    {"process_leader", 0, UINT16_MAX},
+    {"process_dynamic_tapping_term", QK_DYNAMIC_TAPPING_TERM_PRINT, QK_DYNAMIC_TAPPING_TERM_DOWN},
+    {"process_magic", QK_MAGIC, QK_MAGIC_MAX},
+    {"process_grave_esc", QK_GRAVE_ESCAPE, QK_GRAVE_ESCAPE},
+    {"process_underglow", QK_LIGHTING, QK_LIGHTING_MAX},
+    {"process_rgb_matrix", QK_LIGHTING, QK_LIGHTING_MAX},
+    {"process_programmable_button", QK_PROGRAMMABLE_BUTTON, QK_PROGRAMMABLE_BUTTON_MAX},
+    {"process_autocorrect", 0, UINT16_MAX},
+    {"process_tri_layer", QK_TRI_LAYER_LOWER, QK_TRI_LAYER_UPPER},
+    {"process_default_layer", QK_PERSISTENT_DEF_LAYER, QK_PERSISTENT_DEF_LAYER_MAX},
+    {"process_layer_lock", 0, UINT16_MAX},
+    {"process_oneshot", QK_ONE_SHOT_ON, QK_ONE_SHOT_TOGGLE},
+    {"process_quantum", 0, UINT16_MAX},
+};
+
+// The handlers that may act on `keycode`, up to and including `consumer`, the one that returns false
+static std::vector<std::string> expected_calls(uint16_t keycode, const char *consumer) {
+    std::vector<std::string> expected;
+    for (const handler_t &handler : handler_order) {
+        if (keycode < handler.first || keycode > handler.last) {
+            continue;
+        }
+        expected.push_back(handler.name);
+        if (consumer != nullptr && expected.back() == consumer) {
+            break;
+        }
+    }
+    return expected;
+}
+
+class ProcessRecord : public TestFixture {
+   protected:
+    void expect_handlers(KeymapKey &key, const char *press_consumer, const char *release_consumer) {
+        TestDriver driver;
+        EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+        set_keymap({key});
+
+        calls.clear();
+        key.press();
+        run_one_scan_loop();
+        EXPECT_EQ(calls, expected_calls(key.code, press_consumer)) << "on press of " << key.name;
+
+        calls.clear();
+        key.release();
+        run_one_scan_loop();
+        EXPECT_EQ(calls, expected_calls(key.code, release_consumer)) << "on release of " << key.name;
+
+        VERIFY_AND_CLEAR(driver);
+    }
+};
+
+TEST_F(ProcessRecord, BasicKeycodeVisitsOnlyObservers) {
+    KeymapKey key = KeymapKey(0, 0, 0, KC_A);
+    expect_handlers(key, nullptr, nullptr);
+}
+
+TEST_F(ProcessRecord, UserKeycodeVisitsOnlyObservers) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_USER);
+    expect_handlers(key, nullptr, nullptr);
+}
+
+TEST_F(ProcessRecord, UnicodeKeycodeVisitsOnlyObservers) {
+    KeymapKey key = KeymapKey(0, 0, 0, UC(0x00E9));
+    expect_handlers(key, nullptr, nullptr);
+}
+
+TEST_F(ProcessRecord, SecureKeycodeStopsAtSecureOnRelease) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_SECURE_LOCK);
+    expect_handlers(key, nullptr, "process_secure");
+}
+
+TEST_F(ProcessRecord, DynamicTappingTermKeycodeStopsOnPress) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_DYNAMIC_TAPPING_TERM_PRINT);
+    expect_handlers(key, "process_dynamic_tapping_term", nullptr);
+}
+
+TEST_F(ProcessRecord, MagicKeycodeStopsOnPress) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_MAGIC_TOGGLE_NKRO);
+    expect_handlers(key, "process_magic", nullptr);
+}
+
+TEST_F(ProcessRecord, GraveEscapeStopsAtGraveEscape) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_GRAVE_ESCAPE);
+    expect_handlers(key, "process_grave_esc", "process_grave_esc");
+}
+
+TEST_F(ProcessRecord, RgbMatrixKeycodeStopsOnRelease) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_RGB_MATRIX_TOGGLE);
+    expect_handlers(key, nullptr, "process_rgb_matrix");
+}
+
+TEST_F(ProcessRecord, ProgrammableButtonPassesThrough) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_PROGRAMMABLE_BUTTON_1);
+    expect_handlers(key, nullptr, nullptr);
+}
+
+TEST_F(ProcessRecord, TriLayerKeycodeStopsAtTriLayer) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_TRI_LAYER_LOWER);
+    expect_handlers(key, "process_tri_layer", "process_tri_layer");
+}
+
+TEST_F(ProcessRecord, PersistentDefaultLayerStopsOnRelease) {
+    KeymapKey key = KeymapKey(0, 0, 0, PDF(0));
+    expect_handlers(key, nullptr, "process_default_layer");
+}
+
+TEST_F(ProcessRecord, OneShotKeycodeStopsOnPress) {
+    KeymapKey key = KeymapKey(0, 0, 0, QK_ONE_SHOT_TOGGLE);
+    expect_handlers(key, "process_oneshot", nullptr);
+}
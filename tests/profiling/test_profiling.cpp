@@ -0,0 +1,131 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "profiling.h"
+
+static uint32_t fake_timestamp = 0;
+
+uint32_t profiling_timestamp(void) {
+    return fake_timestamp;
+}
+}
+
+class Profiling : public TestFixture {
+   protected:
+    void SetUp() override {
+        fake_timestamp = 0;
+        profiling_reset();
+    }
+
+    void run_task(profiling_task_t task, uint32_t duration) {
+        profiling_begin(task);
+        fake_timestamp += duration;
+        profiling_end(task);
+    }
+
+    static uint32_t get_u32_be(const uint8_t *data) {
+        return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+    }
+};
+
+TEST_F(Profiling, RecordsMinAverageMax) {
+    run_task(PROFILING_TASK_USER, 5);
+    run_task(PROFILING_TASK_USER, 1);
+    run_task(PROFILING_TASK_USER, 100);
+
+    const profiling_stats_t *stats = profiling_get_stats(PROFILING_TASK_USER);
+    EXPECT_EQ(stats->count, 3);
+    EXPECT_EQ(stats->min, 1);
+    EXPECT_EQ(stats->max, 100);
+    EXPECT_EQ(stats->total, 106);
+}
+
+TEST_F(Profiling, HistogramBucketsBySignificantBits) {
+    run_task(PROFILING_TASK_USER, 0);
+    run_task(PROFILING_TASK_USER, 1);
+    run_task(PROFILING_TASK_USER, 5);
+    run_task(PROFILING_TASK_USER, 7);
+    run_task(PROFILING_TASK_USER, 100);
+    run_task(PROFILING_TASK_USER, UINT32_MAX);
+
+    const profiling_stats_t *stats = profiling_get_stats(PROFILING_TASK_USER);
+    EXPECT_EQ(stats->histogram[0], 1);
+    EXPECT_EQ(stats->histogram[1], 1);
+    EXPECT_EQ(stats->histogram[3], 2);
+    EXPECT_EQ(stats->histogram[7], 1);
+    EXPECT_EQ(stats->histogram[PROFILING_HISTOGRAM_BUCKETS - 1], 1);
+}
+
+TEST_F(Profiling, ResetClearsStats) {
+    run_task(PROFILING_TASK_USER, 10);
+    profiling_reset();
+
+    const profiling_stats_t *stats = profiling_get_stats(PROFILING_TASK_USER);
+    EXPECT_EQ(stats->count, 0);
+    EXPECT_EQ(stats->max, 0);
+    EXPECT_EQ(stats->histogram[4], 0);
+}
+
+TEST_F(Profiling, KeyboardTasksAreTimed) {
+    TestDriver driver;
+
+    idle_for(10);
+
+    EXPECT_EQ(profiling_get_stats(PROFILING_TASK_MATRIX)->count, 10);
+    EXPECT_EQ(profiling_get_stats(PROFILING_TASK_QUANTUM)->count, 10);
+    EXPECT_EQ(profiling_get_stats(PROFILING_TASK_LED)->count, 10);
+    EXPECT_EQ(profiling_get_stats(PROFILING_TASK_RGB_MATRIX)->count, 0);
+}
+
+TEST_F(Profiling, MatrixScanRateFromProfiling) {
+    TestDriver driver;
+
+    idle_for(500);
+    EXPECT_EQ(get_matrix_scan_rate(), 1000);
+}
+
+TEST_F(Profiling, RawHidReportsStats) {
+    uint8_t report[32] = {PROFILING_RAW_HID_COMMAND, id_profiling_get_stats, PROFILING_TASK_USER};
+
+    run_task(PROFILING_TASK_USER, 2);
+    run_task(PROFILING_TASK_USER, 6);
+
+    EXPECT_TRUE(profiling_raw_hid_receive(report, sizeof(report)));
+    EXPECT_EQ(report[1], id_profiling_get_stats);
+    EXPECT_EQ(get_u32_be(&report[3]), 2);
+    EXPECT_EQ(get_u32_be(&report[7]), 2);
+    EXPECT_EQ(get_u32_be(&report[11]), 6);
+    EXPECT_EQ(get_u32_be(&report[15]), 4);
+    EXPECT_STREQ((const char *)&report[19], "user");
+}
+
+TEST_F(Profiling, RawHidReportsHistogram) {
+    uint8_t report[32] = {PROFILING_RAW_HID_COMMAND, id_profiling_get_histogram, PROFILING_TASK_USER, 2};
+
+    run_task(PROFILING_TASK_USER, 2);
+    run_task(PROFILING_TASK_USER, 3);
+    run_task(PROFILING_TASK_USER, 4);
+
+    EXPECT_TRUE(profiling_raw_hid_receive(report, sizeof(report)));
+    EXPECT_EQ((report[4] << 8) | report[5], 2); // bucket 2
+    EXPECT_EQ((report[6] << 8) | report[7], 1); // bucket 3
+    EXPECT_EQ((report[8] << 8) | report[9], 0); // bucket 4
+}
+
+TEST_F(Profiling, RawHidRejectsUnknownTask) {
+    uint8_t report[32] = {PROFILING_RAW_HID_COMMAND, id_profiling_get_stats, PROFILING_TASK_COUNT};
+
+    EXPECT_TRUE(profiling_raw_hid_receive(report, sizeof(report)));
+    EXPECT_EQ(report[1], 0xFF);
+}
+
+TEST_F(Profiling, RawHidIgnoresOtherCommands) {
+    uint8_t report[32] = {0x01, id_profiling_reset};
+
+    run_task(PROFILING_TASK_USER, 2);
+    EXPECT_FALSE(profiling_raw_hid_receive(report, sizeof(report)));
+    EXPECT_EQ(profiling_get_stats(PROFILING_TASK_USER)->count, 1);
+}
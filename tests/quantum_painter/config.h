@@ -0,0 +1,12 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_ASYNC_COMMS 1 // TRUE is not defined on the test platform
+#define QUANTUM_PAINTER_DUMMY_COMMS_ASYNC_BUSY_POLLS 3
+#define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 64
+#define QUANTUM_PAINTER_DISPLAY_TIMEOUT 0
+#define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 4
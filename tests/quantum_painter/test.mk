@@ -0,0 +1,14 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+# An ILI9341 panel, talking to the capturing comms driver in the test rather than SPI
+OPT_DEFS += -DQUANTUM_PAINTER_ILI9341_ENABLE
+COMMON_VPATH += \
+    $(DRIVER_PATH)/painter/tft_panel \
+    $(DRIVER_PATH)/painter/ili9xxx
+SRC += \
+    $(DRIVER_PATH)/painter/tft_panel/qp_tft_panel.c \
+    $(DRIVER_PATH)/painter/ili9xxx/qp_ili9341.c
@@ -0,0 +1,285 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+#include "qp_draw.h"
+#include "qp_surface.h"
+#include "qp_tft_panel.h"
+
+extern const tft_panel_dc_reset_painter_driver_vtable_t ili9341_driver_vtable;
+
+void qp_internal_task(void);
+}
+
+#define COMMAND_FLAG 0x100
+
+/* Everything sent to a panel, with commands flagged, along with the comms state at the time. */
+struct capture_t {
+    std::vector<uint16_t> sent;
+    const uint8_t        *in_flight       = nullptr;
+    uint32_t              in_flight_count = 0;
+    bool                  started         = false;
+    uint32_t              starts          = 0;
+    uint32_t              async_transfers = 0;
+};
+
+static capture_t *get_capture(painter_device_t device) {
+    return (capture_t *)((painter_driver_t *)device)->comms_config;
+}
+
+static bool capture_init(painter_device_t device) {
+    return true;
+}
+
+static bool capture_start(painter_device_t device) {
+    capture_t *capture = get_capture(device);
+    EXPECT_FALSE(capture->started) << "Comms started twice";
+    capture->started = true;
+    capture->starts++;
+    return true;
+}
+
+static bool capture_stop(painter_device_t device) {
+    capture_t *capture = get_capture(device);
+    EXPECT_EQ(capture->in_flight, nullptr) << "Comms stopped during a background transfer";
+    capture->started = false;
+    return true;
+}
+
+static uint32_t capture_send(painter_device_t device, const void *data, uint32_t byte_count) {
+    capture_t *capture = get_capture(device);
+    EXPECT_TRUE(capture->started) << "Data sent without starting comms";
+    EXPECT_EQ(capture->in_flight, nullptr) << "Data sent during a background transfer";
+    const uint8_t *p = (const uint8_t *)data;
+    capture->sent.insert(capture->sent.end(), p, p + byte_count);
+    return dummy_comms_send(device, data, byte_count);
+}
+
+static bool capture_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    capture_t *capture = get_capture(device);
+    EXPECT_TRUE(capture->started) << "Data sent without starting comms";
+    EXPECT_EQ(capture->in_flight, nullptr) << "Data sent during a background transfer";
+    capture->in_flight       = (const uint8_t *)data;
+    capture->in_flight_count = byte_count;
+    capture->async_transfers++;
+    return dummy_comms_send_async(device, data, byte_count);
+}
+
+static bool capture_busy(painter_device_t device) {
+    if (dummy_comms_busy(device)) {
+        return true;
+    }
+
+    // Captured on completion, so anything drawing into the buffer while it was in flight shows up as a mismatch
+    capture_t *capture = get_capture(device);
+    if (capture->in_flight) {
+        capture->sent.insert(capture->sent.end(), capture->in_flight, capture->in_flight + capture->in_flight_count);
+        capture->in_flight = nullptr;
+    }
+    return false;
+}
+
+static bool capture_send_command(painter_device_t device, uint8_t cmd) {
+    capture_t *capture = get_capture(device);
+    EXPECT_TRUE(capture->started) << "Command sent without starting comms";
+    EXPECT_EQ(capture->in_flight, nullptr) << "Command sent during a background transfer";
+    capture->sent.push_back(COMMAND_FLAG | cmd);
+    return true;
+}
+
+static bool capture_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
+    for (size_t i = 0; i < sequence_len;) {
+        uint8_t num_bytes = sequence[i + 2];
+        capture_send_command(device, sequence[i]);
+        if (num_bytes > 0) {
+            capture_send(device, &sequence[i + 3], num_bytes);
+        }
+        i += (3 + num_bytes);
+    }
+    return true;
+}
+
+static painter_comms_with_command_vtable_t make_comms_vtable(bool async) {
+    painter_comms_with_command_vtable_t vtable = {};
+    vtable.base.comms_init       = capture_init;
+    vtable.base.comms_start      = capture_start;
+    vtable.base.comms_stop       = capture_stop;
+    vtable.base.comms_send       = capture_send;
+    vtable.base.comms_send_async = async ? capture_send_async : nullptr;
+    vtable.base.comms_busy       = async ? capture_busy : nullptr;
+    vtable.send_command          = capture_send_command;
+    vtable.bulk_command_sequence = capture_bulk_command_sequence;
+    return vtable;
+}
+
+static const painter_comms_with_command_vtable_t sync_comms_vtable  = make_comms_vtable(false);
+static const painter_comms_with_command_vtable_t async_comms_vtable = make_comms_vtable(true);
+
+class QuantumPainterAsyncComms : public TestFixture {
+   protected:
+    void SetUp() override {
+        make_device(&sync_device, &sync_capture, &sync_comms_vtable);
+        make_device(&async_device, &async_capture, &async_comms_vtable);
+    }
+
+    void make_device(tft_panel_dc_reset_painter_device_t *device, capture_t *capture, const painter_comms_with_command_vtable_t *comms_vtable) {
+        *device                            = {};
+        *capture                           = {};
+        device->base.driver_vtable         = (const painter_driver_vtable_t *)&ili9341_driver_vtable;
+        device->base.comms_vtable          = (const painter_comms_vtable_t *)comms_vtable;
+        device->base.native_bits_per_pixel = 16;
+        device->base.panel_width           = 240;
+        device->base.panel_height          = 320;
+        device->base.rotation              = QP_ROTATION_0;
+        device->base.comms_config          = capture;
+    }
+
+    /* Exercises every path that sends pixel data. */
+    static void draw(painter_device_t device, painter_device_t surface) {
+        EXPECT_TRUE(qp_init(device, QP_ROTATION_0));
+        EXPECT_TRUE(qp_rect(device, 0, 0, 239, 319, 0, 0, 0, true));
+        EXPECT_TRUE(qp_rect(device, 10, 10, 100, 50, 85, 255, 255, false));
+        EXPECT_TRUE(qp_line(device, 0, 0, 200, 150, 170, 255, 255));
+        EXPECT_TRUE(qp_circle(device, 120, 160, 40, 43, 255, 255, true));
+        EXPECT_TRUE(qp_ellipse(device, 120, 160, 60, 20, 200, 255, 128, false));
+        EXPECT_TRUE(qp_ellipse(device, 60, 200, 10, 50, 100, 255, 255, true));
+        EXPECT_TRUE(qp_setpixel(device, 239, 319, 0, 0, 255));
+
+        uint16_t pixels[37];
+        for (size_t i = 0; i < 37; i++) {
+            pixels[i] = i * 1771;
+        }
+        EXPECT_TRUE(qp_viewport(device, 3, 3, 39, 3));
+        EXPECT_TRUE(qp_pixdata(device, pixels, 37));
+
+        EXPECT_TRUE(qp_rect(surface, 0, 0, 31, 23, 20, 255, 255, true));
+        EXPECT_TRUE(qp_circle(surface, 16, 12, 8, 140, 255, 255, true));
+        EXPECT_TRUE(qp_surface_draw(surface, device, 50, 60, true));
+        EXPECT_TRUE(qp_flush(device));
+    }
+
+    tft_panel_dc_reset_painter_device_t sync_device, async_device;
+    capture_t                           sync_capture, async_capture;
+};
+
+TEST_F(QuantumPainterAsyncComms, MatchesSynchronousOutput) {
+    TestDriver driver;
+
+    static uint8_t   surface_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(32, 24, 16)];
+    painter_device_t surface = qp_make_rgb565_surface(32, 24, surface_buffer);
+    EXPECT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    draw((painter_device_t)&sync_device, surface);
+    draw((painter_device_t)&async_device, surface);
+
+    EXPECT_EQ(sync_capture.async_transfers, 0);
+    EXPECT_GT(async_capture.async_transfers, 0);
+    EXPECT_FALSE(async_capture.started);
+    EXPECT_GT(sync_capture.sent.size(), 320 * 240 * 2);
+    EXPECT_TRUE(sync_capture.sent == async_capture.sent) << "Background transmission changed the output";
+}
+
+TEST_F(QuantumPainterAsyncComms, DrawingReturnsBeforeTransmissionCompletes) {
+    TestDriver       driver;
+    painter_device_t async = (painter_device_t)&async_device;
+    painter_device_t sync  = (painter_device_t)&sync_device;
+
+    EXPECT_TRUE(qp_init(async, QP_ROTATION_0));
+    async_capture.starts = 0;
+
+    for (int i = 0; i < 2; i++) {
+        EXPECT_TRUE(qp_rect(async, 0, 0, 99, 99, 0, 0, 0, true));
+
+        // The last buffer is still in flight, so the comms driver has not been stopped yet
+        EXPECT_TRUE(qp_is_busy(async));
+        EXPECT_TRUE(async_capture.started);
+    }
+
+    // Drawing on a device with a deferred stop carries on without restarting its comms
+    EXPECT_EQ(async_capture.starts, 1);
+
+    // Starting another device's comms waits for the transfer, and stops the first device
+    EXPECT_TRUE(qp_init(sync, QP_ROTATION_0));
+    EXPECT_FALSE(qp_is_busy(async));
+    EXPECT_FALSE(async_capture.started);
+    EXPECT_FALSE(qp_is_busy(sync));
+    EXPECT_FALSE(sync_capture.started);
+
+    // Otherwise, the Quantum Painter task completes it
+    EXPECT_TRUE(qp_rect(async, 0, 0, 99, 99, 0, 0, 0, true));
+    int tasks = 0;
+    while (async_capture.started && tasks < 100) {
+        qp_internal_task();
+        tasks++;
+    }
+    EXPECT_GT(tasks, 0);
+    EXPECT_LT(tasks, 100);
+    EXPECT_FALSE(qp_is_busy(async));
+}
+
+TEST_F(QuantumPainterAsyncComms, OtherSpiDeviceCanStartStraightAfterDrawing) {
+    TestDriver       driver;
+    painter_device_t async = (painter_device_t)&async_device;
+
+    EXPECT_TRUE(qp_init(async, QP_ROTATION_0));
+    EXPECT_TRUE(qp_flush(async));
+    async_capture.starts = 0;
+
+    // A plain draw call returns with its last buffer in flight and the stop deferred
+    EXPECT_TRUE(qp_rect(async, 0, 0, 99, 99, 0, 0, 0, true));
+    EXPECT_TRUE(async_capture.started);
+    EXPECT_NE(async_capture.in_flight, nullptr);
+
+    // Another device on the bus calls spi_start(), which has the display complete the transfer and let go first
+    spi_release_deferred();
+    EXPECT_FALSE(qp_is_busy(async));
+    EXPECT_FALSE(async_capture.started);
+    EXPECT_EQ(async_capture.in_flight, nullptr);
+
+    // Nothing is held any more, so it has no effect
+    spi_release_deferred();
+    EXPECT_FALSE(async_capture.started);
+    EXPECT_EQ(async_capture.starts, 1);
+}
+
+TEST_F(QuantumPainterAsyncComms, FlushWaitsForTransmission) {
+    TestDriver       driver;
+    painter_device_t async = (painter_device_t)&async_device;
+
+    EXPECT_TRUE(qp_init(async, QP_ROTATION_0));
+    EXPECT_TRUE(qp_rect(async, 0, 0, 99, 99, 0, 0, 0, true));
+    EXPECT_TRUE(qp_flush_async(async));
+    EXPECT_TRUE(qp_is_busy(async));
+
+    EXPECT_TRUE(qp_flush(async));
+    EXPECT_FALSE(qp_is_busy(async));
+    EXPECT_FALSE(async_capture.started);
+    EXPECT_EQ(async_capture.in_flight, nullptr);
+}
+
+TEST_F(QuantumPainterAsyncComms, FillsCanBeResentInLargerChunks) {
+    TestDriver       driver;
+    painter_device_t async = (painter_device_t)&async_device;
+
+    EXPECT_TRUE(qp_init(async, QP_ROTATION_0));
+    EXPECT_TRUE(qp_flush(async));
+    async_capture.sent.clear();
+    memset(qp_internal_pixdata_buffers, 0, sizeof(qp_internal_pixdata_buffers));
+
+    // A single pixel first, then the whole fill, as the outline and circle drawing does
+    EXPECT_TRUE(qp_comms_start(async));
+    qp_internal_fill_pixdata(async, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE / 2, 0, 0, 255);
+    EXPECT_EQ(qp_comms_send(async, qp_internal_global_pixdata_buffer, 2), 2);
+    EXPECT_EQ(qp_comms_send(async, qp_internal_global_pixdata_buffer, QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE), QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE);
+    qp_comms_stop(async);
+    qp_comms_wait(async);
+
+    EXPECT_EQ(async_capture.async_transfers, 2);
+    EXPECT_EQ(async_capture.sent, std::vector<uint16_t>(2 + QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE, 0xFF));
+}
@@ -0,0 +1,152 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qff.h"
+}
+
+/* A unicode-only font where every glyph has its own width, so that qp_textwidth() tells which glyph was found. */
+struct test_glyph_t {
+    uint32_t code_point;
+    uint8_t  width;
+};
+
+static const test_glyph_t test_glyphs[] = {
+    {0x00E9, 1}, {0x00FC, 2}, {0x03A9, 3}, {0x0416, 4}, {0x2014, 5}, {0x20AC, 6}, {0x2190, 7}, {0x2192, 8}, {0x263A, 9}, {0x1F600, 10},
+};
+
+static const size_t test_glyph_count = sizeof(test_glyphs) / sizeof(test_glyphs[0]);
+
+static std::vector<uint8_t> make_font(bool sorted) {
+    std::vector<test_glyph_t> glyphs(test_glyphs, test_glyphs + test_glyph_count);
+    if (!sorted) {
+        std::reverse(glyphs.begin(), glyphs.end());
+    }
+
+    qff_font_descriptor_v1_t descriptor = {};
+    descriptor.header.type_id           = QFF_FONT_DESCRIPTOR_TYPEID;
+    descriptor.header.neg_type_id       = (uint8_t)~QFF_FONT_DESCRIPTOR_TYPEID;
+    descriptor.header.length            = sizeof(qff_font_descriptor_v1_t) - sizeof(qgf_block_header_v1_t);
+    descriptor.magic                    = QFF_MAGIC;
+    descriptor.qff_version              = 0x01;
+    descriptor.line_height              = 8;
+    descriptor.has_ascii_table          = false;
+    descriptor.num_unicode_glyphs       = glyphs.size();
+    descriptor.format                   = GRAYSCALE_1BPP;
+    descriptor.flags                    = sorted ? QFF_FONT_FLAG_SORTED_UNICODE : 0;
+
+    qgf_block_header_v1_t table_header = {};
+    table_header.type_id               = QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID;
+    table_header.neg_type_id           = (uint8_t)~QFF_UNICODE_GLYPH_DESCRIPTOR_TYPEID;
+    table_header.length                = glyphs.size() * sizeof(qff_unicode_glyph_v1_t);
+
+    std::vector<uint8_t> font;
+    auto                 append = [&](const void *data, size_t length) { font.insert(font.end(), (const uint8_t *)data, (const uint8_t *)data + length); };
+
+    append(&descriptor, sizeof(descriptor));
+    append(&table_header, sizeof(table_header));
+    uint32_t offset = 0;
+    for (const test_glyph_t &glyph : glyphs) {
+        qff_unicode_glyph_v1_t entry = {};
+        entry.code_point             = glyph.code_point;
+        entry.value                  = (offset << QFF_GLYPH_WIDTH_BITS) | glyph.width;
+        append(&entry, sizeof(entry));
+        offset += glyph.width;
+    }
+
+    // The glyph image data is never read when only measuring text, but each glyph's offset must still be inside it
+    qgf_block_header_v1_t data_header = {};
+    data_header.type_id               = 0x04;
+    data_header.neg_type_id           = (uint8_t)~0x04;
+    data_header.length                = offset;
+    append(&data_header, sizeof(data_header));
+    font.resize(font.size() + data_header.length);
+
+    qff_font_descriptor_v1_t *written = (qff_font_descriptor_v1_t *)font.data();
+    written->total_file_size          = font.size();
+    written->neg_total_file_size      = ~(uint32_t)font.size();
+    return font;
+}
+
+/* Sets the width of a glyph in a font that is already loaded, without the font noticing. */
+static void set_glyph_width(std::vector<uint8_t> &font, uint32_t code_point, uint8_t width) {
+    qff_unicode_glyph_v1_t *entries = (qff_unicode_glyph_v1_t *)(font.data() + sizeof(qff_font_descriptor_v1_t) + sizeof(qgf_block_header_v1_t));
+    for (size_t i = 0; i < test_glyph_count; ++i) {
+        if (entries[i].code_point == code_point) {
+            entries[i].value = (entries[i].value & QFF_GLYPH_OFFSET_MASK) | width;
+        }
+    }
+}
+
+static std::string utf8(uint32_t code_point) {
+    std::string encoded;
+    if (code_point < 0x80) {
+        encoded += (char)code_point;
+    } else if (code_point < 0x800) {
+        encoded += (char)(0xC0 | (code_point >> 6));
+        encoded += (char)(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        encoded += (char)(0xE0 | (code_point >> 12));
+        encoded += (char)(0x80 | ((code_point >> 6) & 0x3F));
+        encoded += (char)(0x80 | (code_point & 0x3F));
+    } else {
+        encoded += (char)(0xF0 | (code_point >> 18));
+        encoded += (char)(0x80 | ((code_point >> 12) & 0x3F));
+        encoded += (char)(0x80 | ((code_point >> 6) & 0x3F));
+        encoded += (char)(0x80 | (code_point & 0x3F));
+    }
+    return encoded;
+}
+
+class QffGlyphLookup : public ::testing::TestWithParam<bool> {
+   protected:
+    std::vector<uint8_t>  font_data = make_font(GetParam());
+    painter_font_handle_t font      = nullptr;
+
+    void SetUp() override {
+        font = qp_load_font_mem(font_data.data());
+        ASSERT_NE(font, nullptr);
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+    }
+};
+
+TEST_P(QffGlyphLookup, FindsEveryGlyph) {
+    for (const test_glyph_t &glyph : test_glyphs) {
+        EXPECT_EQ(qp_textwidth(font, utf8(glyph.code_point).c_str()), glyph.width) << "U+" << std::hex << glyph.code_point;
+    }
+}
+
+TEST_P(QffGlyphLookup, MissingGlyphFails) {
+    EXPECT_EQ(qp_textwidth(font, utf8(0x00E8).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x0001).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x1F601).c_str()), 0);
+}
+
+TEST_P(QffGlyphLookup, MeasuresStrings) {
+    std::string text = utf8(0x00E9) + utf8(0x1F600) + utf8(0x2014) + utf8(0x00E9);
+    EXPECT_EQ(qp_textwidth(font, text.c_str()), 1 + 10 + 5 + 1);
+}
+
+TEST_P(QffGlyphLookup, RepeatedGlyphsComeFromTheCache) {
+    EXPECT_EQ(qp_textwidth(font, utf8(0x03A9).c_str()), 3);
+
+    // Still found with the width it had when cached
+    set_glyph_width(font_data, 0x03A9, 30);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x03A9).c_str()), 3);
+
+    // Looking up as many other glyphs as the cache holds evicts it
+    static_assert(QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE == 4, "four other glyphs are looked up below");
+    std::string others = utf8(0x00E9) + utf8(0x00FC) + utf8(0x0416) + utf8(0x2014);
+    EXPECT_EQ(qp_textwidth(font, others.c_str()), 1 + 2 + 4 + 5);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x03A9).c_str()), 30);
+}
+
+INSTANTIATE_TEST_CASE_P(Tables, QffGlyphLookup, ::testing::Values(true, false), [](const ::testing::TestParamInfo<bool> &info) { return info.param ? "Sorted" : "Unsorted"; });
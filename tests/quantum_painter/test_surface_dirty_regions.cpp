@@ -0,0 +1,161 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+#include "qp_surface_internal.h"
+}
+
+typedef std::tuple<uint16_t, uint16_t, uint16_t, uint16_t> region_t;
+
+static std::vector<region_t> dirty_regions(painter_device_t device) {
+    surface_painter_device_t *surface = (surface_painter_device_t *)device;
+    std::vector<region_t>     regions;
+    for (uint8_t i = 0; i < surface->dirty.num_regions; ++i) {
+        const surface_dirty_region_t &region = surface->dirty.regions[i];
+        regions.push_back(region_t(region.l, region.t, region.r, region.b));
+    }
+    std::sort(regions.begin(), regions.end());
+    return regions;
+}
+
+static bool is_dirty(painter_device_t device) {
+    return ((surface_painter_device_t *)device)->dirty.is_dirty;
+}
+
+static bool region_contains(const region_t &region, uint16_t x, uint16_t y) {
+    return x >= std::get<0>(region) && y >= std::get<1>(region) && x <= std::get<2>(region) && y <= std::get<3>(region);
+}
+
+class SurfaceDirtyRegions : public ::testing::Test {
+   protected:
+    surface_painter_device_t devices[2]                                                   = {};
+    uint8_t                  source_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(32, 32, 16)] = {};
+    uint8_t                  target_buffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(64, 64, 16)] = {};
+    painter_device_t         source                                                       = nullptr;
+    painter_device_t         target                                                       = nullptr;
+
+    void SetUp() override {
+        source = qp_make_rgb565_surface_advanced(devices, 2, 32, 32, source_buffer);
+        target = qp_make_rgb565_surface_advanced(devices, 2, 64, 64, target_buffer);
+        ASSERT_NE(source, nullptr);
+        ASSERT_NE(target, nullptr);
+        ASSERT_TRUE(qp_init(source, QP_ROTATION_0));
+        ASSERT_TRUE(qp_init(target, QP_ROTATION_0));
+        ASSERT_TRUE(qp_flush(source));
+        ASSERT_TRUE(qp_flush(target));
+    }
+
+    uint16_t pixel(painter_device_t device, uint16_t x, uint16_t y) {
+        surface_painter_device_t *surface = (surface_painter_device_t *)device;
+        return surface->u16buffer[y * surface->base.panel_width + x];
+    }
+};
+
+TEST_F(SurfaceDirtyRegions, InitMarksEverything) {
+    ASSERT_TRUE(qp_init(source, QP_ROTATION_0));
+    EXPECT_TRUE(is_dirty(source));
+    EXPECT_EQ(dirty_regions(source), std::vector<region_t>({region_t(0, 0, 31, 31)}));
+}
+
+TEST_F(SurfaceDirtyRegions, FlushClearsRegions) {
+    EXPECT_FALSE(is_dirty(source));
+    EXPECT_TRUE(dirty_regions(source).empty());
+}
+
+TEST_F(SurfaceDirtyRegions, UnchangedPixelsAreNotDirty) {
+    EXPECT_TRUE(qp_rect(source, 4, 4, 10, 10, 0, 0, 0, true));
+    EXPECT_FALSE(is_dirty(source));
+    EXPECT_TRUE(dirty_regions(source).empty());
+}
+
+TEST_F(SurfaceDirtyRegions, DistantRectanglesStaySeparate) {
+    EXPECT_TRUE(qp_rect(source, 1, 2, 4, 5, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(source, 25, 20, 30, 29, 0, 255, 255, true));
+    EXPECT_EQ(dirty_regions(source), std::vector<region_t>({region_t(1, 2, 4, 5), region_t(25, 20, 30, 29)}));
+}
+
+TEST_F(SurfaceDirtyRegions, OverlappingRectanglesMerge) {
+    EXPECT_TRUE(qp_rect(source, 2, 2, 10, 10, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(source, 8, 8, 14, 12, 85, 255, 255, true));
+    EXPECT_EQ(dirty_regions(source), std::vector<region_t>({region_t(2, 2, 14, 12)}));
+}
+
+TEST_F(SurfaceDirtyRegions, AdjacentRectanglesMerge) {
+    EXPECT_TRUE(qp_rect(source, 2, 2, 5, 5, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(source, 6, 2, 9, 5, 0, 255, 255, true));
+    EXPECT_EQ(dirty_regions(source), std::vector<region_t>({region_t(2, 2, 9, 5)}));
+}
+
+TEST_F(SurfaceDirtyRegions, GrowingRegionSwallowsOthers) {
+    EXPECT_TRUE(qp_rect(source, 0, 0, 1, 1, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(source, 10, 10, 11, 11, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(source, 20, 20, 21, 21, 0, 255, 255, true));
+    EXPECT_EQ(dirty_regions(source).size(), 3);
+
+    EXPECT_TRUE(qp_rect(source, 0, 0, 15, 15, 170, 255, 255, true));
+    EXPECT_EQ(dirty_regions(source), std::vector<region_t>({region_t(0, 0, 15, 15), region_t(20, 20, 21, 21)}));
+}
+
+TEST_F(SurfaceDirtyRegions, ClosestRegionsMergeWhenFull) {
+    const uint16_t corners[][2] = {{0, 0}, {28, 0}, {0, 28}, {28, 28}, {22, 22}};
+    for (const auto &corner : corners) {
+        EXPECT_TRUE(qp_rect(source, corner[0], corner[1], corner[0] + 3, corner[1] + 3, 0, 255, 255, true));
+    }
+
+    EXPECT_EQ(dirty_regions(source), std::vector<region_t>({region_t(0, 0, 3, 3), region_t(0, 28, 3, 31), region_t(22, 22, 31, 31), region_t(28, 0, 31, 3)}));
+}
+
+TEST_F(SurfaceDirtyRegions, EveryChangedPixelIsCovered) {
+    // Scattered single pixels, far more than there are regions
+    std::vector<std::pair<uint16_t, uint16_t>> pixels;
+    for (uint16_t i = 0; i < 40; ++i) {
+        pixels.push_back({(uint16_t)((i * 7) % 32), (uint16_t)((i * 13) % 32)});
+    }
+    for (const auto &p : pixels) {
+        EXPECT_TRUE(qp_setpixel(source, p.first, p.second, 0, 255, 255));
+    }
+
+    std::vector<region_t> regions = dirty_regions(source);
+    EXPECT_LE(regions.size(), SURFACE_NUM_DIRTY_REGIONS);
+    for (const auto &p : pixels) {
+        EXPECT_TRUE(std::any_of(regions.begin(), regions.end(), [&](const region_t &region) { return region_contains(region, p.first, p.second); })) << "(" << p.first << ", " << p.second << ")";
+    }
+    for (size_t i = 0; i < regions.size(); ++i) {
+        for (size_t j = i + 1; j < regions.size(); ++j) {
+            bool overlap = std::get<0>(regions[i]) <= std::get<2>(regions[j]) && std::get<0>(regions[j]) <= std::get<2>(regions[i]) && std::get<1>(regions[i]) <= std::get<3>(regions[j]) && std::get<1>(regions[j]) <= std::get<3>(regions[i]);
+            EXPECT_FALSE(overlap) << "regions " << i << " and " << j << " overlap";
+        }
+    }
+}
+
+TEST_F(SurfaceDirtyRegions, DrawTransfersOnlyDirtyRegions) {
+    EXPECT_TRUE(qp_rect(source, 1, 2, 4, 5, 0, 255, 255, true));
+    EXPECT_TRUE(qp_rect(source, 25, 20, 30, 29, 85, 255, 255, true));
+
+    // The target is a surface too, so its dirty regions show what was sent to it
+    EXPECT_TRUE(qp_surface_draw(source, target, 8, 16, false));
+    EXPECT_EQ(dirty_regions(target), std::vector<region_t>({region_t(9, 18, 12, 21), region_t(33, 36, 38, 45)}));
+    EXPECT_EQ(pixel(target, 9, 18), pixel(source, 1, 2));
+    EXPECT_EQ(pixel(target, 38, 45), pixel(source, 30, 29));
+    EXPECT_NE(pixel(target, 9, 18), pixel(target, 38, 45));
+    EXPECT_EQ(pixel(target, 20, 30), 0);
+
+    // Drawing clears the source's dirty regions
+    EXPECT_FALSE(is_dirty(source));
+    EXPECT_TRUE(dirty_regions(source).empty());
+    EXPECT_TRUE(qp_surface_draw(source, target, 8, 16, false));
+}
+
+TEST_F(SurfaceDirtyRegions, DrawEntireSurface) {
+    EXPECT_TRUE(qp_rect(source, 1, 2, 4, 5, 0, 255, 255, true));
+    EXPECT_TRUE(qp_surface_draw(source, target, 0, 0, true));
+    EXPECT_EQ(dirty_regions(target), std::vector<region_t>({region_t(1, 2, 4, 5)}));
+    EXPECT_FALSE(is_dirty(source));
+}
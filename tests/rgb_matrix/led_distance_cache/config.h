@@ -0,0 +1,17 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define RGB_MATRIX_LED_COUNT 100
+#define RGB_MATRIX_LED_PROCESS_LIMIT 0
+#define RGB_MATRIX_LED_DISTANCE_CACHE
+
+#define ENABLE_RGB_MATRIX_SOLID_SPLASH
+#define ENABLE_RGB_MATRIX_SOLID_MULTISPLASH
+#define ENABLE_RGB_MATRIX_TYPING_HEATMAP
+#define RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP 32
+#define RGB_MATRIX_TYPING_HEATMAP_SPREAD 40
+#define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
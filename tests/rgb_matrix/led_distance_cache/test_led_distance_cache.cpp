@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Same effects as the parent test, with the distances cached
+#include "../test_rgb_matrix_reactive.hpp"
+
+class LedDistanceCache : public RgbMatrixReactive {};
+
+TEST_F(LedDistanceCache, MatchesPoints) {
+    for (uint8_t led_a = 0; led_a < RGB_MATRIX_LED_COUNT; led_a++) {
+        for (uint8_t led_b = 0; led_b < RGB_MATRIX_LED_COUNT; led_b++) {
+            ASSERT_EQ(rgb_matrix_led_distance(led_a, led_b), reference_distance(led_a, led_b)) << "LEDs " << (int)led_a << "," << (int)led_b;
+        }
+    }
+}
+
+TEST_F(LedDistanceCache, UpdatesAfterLayoutChange) {
+    g_led_config.point[0] = (led_point_t){200, 60};
+    rgb_matrix_update_led_distances();
+
+    EXPECT_EQ(rgb_matrix_led_distance(0, 1), reference_distance(0, 1));
+    EXPECT_EQ(rgb_matrix_led_distance(RGB_MATRIX_LED_COUNT - 1, 0), reference_distance(RGB_MATRIX_LED_COUNT - 1, 0));
+
+    test_rgb_matrix_reset_layout();
+    rgb_matrix_update_led_distances();
+    EXPECT_EQ(rgb_matrix_led_distance(0, 1), reference_distance(0, 1));
+}
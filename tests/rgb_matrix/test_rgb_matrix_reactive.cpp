@@ -0,0 +1,5 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Distances calculated on the fly, see led_distance_cache for the cached variant
+#include "test_rgb_matrix_reactive.hpp"
@@ -0,0 +1,88 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "test_rgb_matrix_driver.h"
+#include "lib/lib8tion/lib8tion.h"
+
+void advance_time(uint32_t ms);
+}
+
+class RgbMatrixReactive : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_sethsv_noeeprom(0, 0, 255);
+        rgb_matrix_set_speed_noeeprom(255);
+        clear_hits();
+    }
+
+    // One trip through the task: sync, start, render and flush
+    void render_frame(void) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        for (uint8_t i = 0; i < 4; i++) {
+            rgb_matrix_task();
+        }
+    }
+
+    void clear_hits(void) {
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        advance_time(UINT16_MAX);
+        render_frame();
+        render_frame();
+    }
+
+    void hit_key(uint8_t row, uint8_t col) {
+        rgb_matrix_handle_key_event(row, col, true);
+        rgb_matrix_handle_key_event(row, col, false);
+    }
+
+    static uint8_t reference_distance(uint8_t led_a, uint8_t led_b) {
+        int16_t dx = g_led_config.point[led_a].x - g_led_config.point[led_b].x;
+        int16_t dy = g_led_config.point[led_a].y - g_led_config.point[led_b].y;
+        return sqrt16(dx * dx + dy * dy);
+    }
+};
+
+TEST_F(RgbMatrixReactive, SplashMatchesReferenceDistance) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_SPLASH);
+    hit_key(1, 4);
+    advance_time(40);
+    render_frame();
+
+    uint8_t  hit  = g_last_hit_tracker.index[g_last_hit_tracker.count - 1];
+    uint16_t tick = scale16by8(g_last_hit_tracker.tick[g_last_hit_tracker.count - 1], qadd8(rgb_matrix_get_speed(), 1));
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        uint16_t effect = tick - reference_distance(i, hit);
+        if (effect > 255) effect = 255;
+
+        hsv_t hsv = {rgb_matrix_get_hue(), rgb_matrix_get_sat(), scale8(255 - effect, rgb_matrix_get_val())};
+        EXPECT_EQ(test_rgb_matrix_get_color(i).r, hsv_to_rgb(hsv).r) << "LED " << (int)i;
+    }
+}
+
+TEST_F(RgbMatrixReactive, HeatmapMatchesReferenceDistance) {
+    rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+    render_frame();
+
+    hit_key(2, 5);
+
+    uint8_t hit = g_led_config.matrix_co[2][5];
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t expected = 0;
+            if (row == 2 && col == 5) {
+                expected = RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP;
+            } else if (reference_distance(g_led_config.matrix_co[row][col], hit) <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                expected = MIN(qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, reference_distance(g_led_config.matrix_co[row][col], hit)), RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT);
+            }
+
+            EXPECT_EQ(g_rgb_frame_buffer[row][col], expected) << "key " << (int)row << "," << (int)col;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+
+using ::testing::InSequence;
+
+class SendStringBatch : public TestFixture {};
+
+TEST_F(SendStringBatch, DistinctCharactersShareReport) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("qwerty");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, RepeatedCharacterStartsNewReport) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_H, KC_E, KC_L));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_L, KC_O));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("hello");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, ModifierChangeStartsNewReport) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_REPORT(driver, (KC_LSFT, KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C, KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("ABcd");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, SingleCharacterIsTapped) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("aa");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, BatchIsLimitedToReportSize) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E, KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_G));
+    EXPECT_EMPTY_REPORT(driver);
+    send_string("abcdefg");
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, BatchLeavesRoomForHeldKeys) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_1));
+    register_code(KC_1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_1, KC_A, KC_B, KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_REPORT(driver, (KC_1, KC_F));
+    EXPECT_REPORT(driver, (KC_1));
+    send_string("abcdef");
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    unregister_code(KC_1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SendStringBatch, SpecialSequencesEndBatch) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_C, KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    SEND_STRING("ab" SS_TAP(X_ENTER) "cd");
+    VERIFY_AND_CLEAR(driver);
+}
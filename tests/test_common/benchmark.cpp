@@ -0,0 +1,215 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+#include "test_logger.hpp"
+
+extern "C" {
+#include "host.h"
+}
+
+static std::vector<benchmark_result_t> results;
+static uint64_t                        timer_overhead_ns;
+static uint64_t                        reports;
+
+static uint8_t keyboard_leds(void) {
+    return 0;
+}
+
+static void send_keyboard(report_keyboard_t *report) {
+    reports++;
+}
+
+static void send_nkro(report_nkro_t *report) {
+    reports++;
+}
+
+static void send_mouse(report_mouse_t *report) {
+    reports++;
+}
+
+static void send_extra(report_extra_t *report) {
+    reports++;
+}
+
+static host_driver_t benchmark_driver = {keyboard_leds, send_keyboard, send_nkro, send_mouse, send_extra};
+
+static uint64_t cpu_time_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* The cheapest back to back reading, subtracted from every sample so that short scans are not dominated by the clock. */
+static uint64_t measure_timer_overhead(void) {
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < 1000; i++) {
+        uint64_t start = cpu_time_ns();
+        overhead       = std::min(overhead, cpu_time_ns() - start);
+    }
+    return overhead;
+}
+
+static std::string json_string(const std::string &value) {
+    std::string escaped = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+static void write_json(FILE *file) {
+    fprintf(file, "{\n  \"timer_overhead_ns\": %u,\n  \"results\": [", (unsigned)timer_overhead_ns);
+    for (size_t i = 0; i < results.size(); i++) {
+        const benchmark_result_t &result = results[i];
+        fprintf(file, "%s\n    {\"test\": %s, \"name\": %s, ", i ? "," : "", json_string(result.test).c_str(), json_string(result.name).c_str());
+        fprintf(file, "\"repetitions\": %u, \"scans\": %llu, \"events\": %llu, \"reports\": %llu, ", result.repetitions, (unsigned long long)result.scans, (unsigned long long)result.events, (unsigned long long)result.reports);
+        fprintf(file, "\"total_ns\": %.0f, \"ns_per_scan\": %.1f, \"ns_per_scan_p50\": %.1f, \"ns_per_scan_p99\": %.1f, \"ns_per_scan_max\": %.1f, \"ns_per_event\": %.1f}", result.total_ns, result.ns_per_scan, result.ns_per_scan_p50, result.ns_per_scan_p99, result.ns_per_scan_max, result.ns_per_event);
+    }
+    fprintf(file, "\n  ]\n}\n");
+}
+
+class BenchmarkEnvironment : public testing::Environment {
+   public:
+    void TearDown() override {
+        const char *path = getenv("BENCH_OUTPUT");
+        if (path == nullptr || results.empty()) {
+            return;
+        }
+
+        FILE *file = fopen(path, "w");
+        if (file == nullptr) {
+            ADD_FAILURE() << "could not write benchmark results to " << path;
+            return;
+        }
+        write_json(file);
+        fclose(file);
+        printf("[ BENCH    ] results written to %s\n", path);
+    }
+};
+
+static testing::Environment *const benchmark_environment = testing::AddGlobalTestEnvironment(new BenchmarkEnvironment);
+
+void Benchmark::run(const std::function<void()> &body) {
+    host_driver_t *driver = host_get_driver();
+    host_set_driver(&benchmark_driver);
+    body();
+    host_set_driver(driver);
+
+    // The test log is only printed on failure, keep it from growing with every repetition
+    if (!HasFailure()) {
+        test_logger.reset();
+    }
+}
+
+benchmark_result_t Benchmark::measure(const std::string &name, uint32_t repetitions, const std::function<void()> &body) {
+    if (timer_overhead_ns == 0) {
+        timer_overhead_ns = measure_timer_overhead();
+    }
+
+    // Untimed, so that one-off work such as building lookup tables is not counted
+    run(body);
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        m_matrix[row] = matrix_get_row(row);
+    }
+    m_samples.clear();
+    m_events    = 0;
+    reports     = 0;
+    m_measuring = true;
+    for (uint32_t i = 0; i < repetitions; i++) {
+        run(body);
+    }
+    m_measuring = false;
+
+    return summarize(name, repetitions);
+}
+
+benchmark_result_t Benchmark::measure_call(const std::string &name, uint32_t repetitions, const std::function<void()> &body, uint32_t events) {
+    if (timer_overhead_ns == 0) {
+        timer_overhead_ns = measure_timer_overhead();
+    }
+
+    host_driver_t *driver = host_get_driver();
+    host_set_driver(&benchmark_driver);
+
+    body();
+
+    m_samples.clear();
+    m_events = 0;
+    reports  = 0;
+    for (uint32_t i = 0; i < repetitions; i++) {
+        uint64_t start = cpu_time_ns();
+        body();
+        uint64_t elapsed = cpu_time_ns() - start;
+
+        m_samples.push_back(elapsed > timer_overhead_ns ? elapsed - timer_overhead_ns : 0);
+        m_events += events;
+    }
+
+    host_set_driver(driver);
+    if (!HasFailure()) {
+        test_logger.reset();
+    }
+
+    return summarize(name, repetitions);
+}
+
+benchmark_result_t Benchmark::summarize(const std::string &name, uint32_t repetitions) {
+    benchmark_result_t result = {};
+    const auto        *info   = testing::UnitTest::GetInstance()->current_test_info();
+    result.test               = std::string(info->test_suite_name()) + "." + info->name();
+    result.name               = name;
+    result.repetitions        = repetitions;
+    result.scans              = m_samples.size();
+    result.events             = m_events;
+    result.reports            = reports;
+
+    for (uint64_t sample : m_samples) {
+        result.total_ns += sample;
+    }
+    if (!m_samples.empty()) {
+        std::sort(m_samples.begin(), m_samples.end());
+        result.ns_per_scan     = result.total_ns / m_samples.size();
+        result.ns_per_scan_p50 = m_samples[m_samples.size() / 2];
+        result.ns_per_scan_p99 = m_samples[m_samples.size() * 99 / 100];
+        result.ns_per_scan_max = m_samples.back();
+    }
+    if (m_events > 0) {
+        result.ns_per_event = result.total_ns / m_events;
+    }
+
+    EXPECT_GT(result.scans, 0) << name << " did not run the keyboard task";
+    printf("[ BENCH    ] %-40s %9.1f ns/scan (p50 %9.1f, p99 %9.1f, max %9.1f) %9.1f ns/event\n", name.c_str(), result.ns_per_scan, result.ns_per_scan_p50, result.ns_per_scan_p99, result.ns_per_scan_max, result.ns_per_event);
+
+    results.push_back(result);
+    return result;
+}
+
+void Benchmark::run_keyboard_task() {
+    if (!m_measuring) {
+        TestFixture::run_keyboard_task();
+        return;
+    }
+
+    // Key events are counted as they reach the matrix, whenever the firmware gets around to processing them
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t row_state = matrix_get_row(row);
+        m_events += __builtin_popcountll(row_state ^ m_matrix[row]);
+        m_matrix[row] = row_state;
+    }
+
+    uint64_t start = cpu_time_ns();
+    TestFixture::run_keyboard_task();
+    uint64_t elapsed = cpu_time_ns() - start;
+
+    m_samples.push_back(elapsed > timer_overhead_ns ? elapsed - timer_overhead_ns : 0);
+}
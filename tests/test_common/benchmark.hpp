@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "matrix.h"
+}
+
+struct benchmark_result_t {
+    std::string test;
+    std::string name;
+    uint32_t    repetitions;
+    uint64_t    scans;
+    uint64_t    events;
+    uint64_t    reports;
+    double      total_ns;
+    double      ns_per_scan;
+    double      ns_per_scan_p50;
+    double      ns_per_scan_p99;
+    double      ns_per_scan_max;
+    double      ns_per_event;
+};
+
+/**
+ * Test fixture for the benchmarks in tests/bench, see docs/unit_testing.md.
+ *
+ * Scenarios are driven with the usual TestFixture helpers, while every run of keyboard_task() and housekeeping_task()
+ * is timed in CPU time. Reports are counted rather than checked, so the host driver does not add to the cost.
+ */
+class Benchmark : public TestFixture {
+   protected:
+    /**
+     * @brief Runs `body` once to warm up, then `repetitions` times while timing every scan loop it makes.
+     *
+     * The result is printed, and written as JSON to the file named by the `BENCH_OUTPUT` environment variable once all
+     * benchmarks have run.
+     */
+    benchmark_result_t measure(const std::string& name, uint32_t repetitions, const std::function<void()>& body);
+
+    /**
+     * @brief Runs `body` once to warm up, then `repetitions` times while timing each call on its own.
+     *
+     * For code that is too cheap to stand out against a whole scan loop, such as a single firmware function. Every call
+     * counts as one scan, and as `events` key events.
+     */
+    benchmark_result_t measure_call(const std::string& name, uint32_t repetitions, const std::function<void()>& body, uint32_t events = 1);
+
+    void run_keyboard_task() override;
+
+   private:
+    void               run(const std::function<void()>& body);
+    benchmark_result_t summarize(const std::string& name, uint32_t repetitions);
+
+    bool                  m_measuring = false;
+    matrix_row_t          m_matrix[MATRIX_ROWS];
+    std::vector<uint64_t> m_samples;
+    uint64_t              m_events;
+};
@@ -0,0 +1,92 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef RGB_MATRIX_ENABLE
+
+#    include <string.h>
+#    include "rgb_matrix.h"
+#    include "test_rgb_matrix_driver.h"
+
+#    define TEST_RGB_MATRIX_WIDTH 224
+#    define TEST_RGB_MATRIX_HEIGHT 64
+
+led_config_t g_led_config;
+
+static rgb_t led_colors[RGB_MATRIX_LED_COUNT];
+
+static led_point_t underglow_point(uint16_t position) {
+    if (position < TEST_RGB_MATRIX_WIDTH) {
+        return (led_point_t){position, 0};
+    }
+    position -= TEST_RGB_MATRIX_WIDTH;
+    if (position < TEST_RGB_MATRIX_HEIGHT) {
+        return (led_point_t){TEST_RGB_MATRIX_WIDTH, position};
+    }
+    position -= TEST_RGB_MATRIX_HEIGHT;
+    if (position < TEST_RGB_MATRIX_WIDTH) {
+        return (led_point_t){TEST_RGB_MATRIX_WIDTH - position, TEST_RGB_MATRIX_HEIGHT};
+    }
+    position -= TEST_RGB_MATRIX_WIDTH;
+    return (led_point_t){0, TEST_RGB_MATRIX_HEIGHT - position};
+}
+
+void test_rgb_matrix_reset_layout(void) {
+    uint16_t key_count       = MATRIX_ROWS * MATRIX_COLS;
+    uint16_t underglow_count = RGB_MATRIX_LED_COUNT > key_count ? RGB_MATRIX_LED_COUNT - key_count : 0;
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t led = row * MATRIX_COLS + col;
+
+            if (led >= RGB_MATRIX_LED_COUNT) {
+                g_led_config.matrix_co[row][col] = NO_LED;
+                continue;
+            }
+            g_led_config.matrix_co[row][col] = led;
+            g_led_config.point[led].x        = col * TEST_RGB_MATRIX_WIDTH / (MATRIX_COLS - 1);
+            g_led_config.point[led].y        = row * TEST_RGB_MATRIX_HEIGHT / (MATRIX_ROWS - 1);
+            g_led_config.flags[led]          = LED_FLAG_KEYLIGHT;
+        }
+    }
+
+    for (uint16_t i = 0; i < underglow_count; i++) {
+        uint16_t led = key_count + i;
+
+        g_led_config.point[led] = underglow_point(i * 2 * (TEST_RGB_MATRIX_WIDTH + TEST_RGB_MATRIX_HEIGHT) / underglow_count);
+        g_led_config.flags[led] = LED_FLAG_UNDERGLOW;
+    }
+}
+
+rgb_t test_rgb_matrix_get_color(uint8_t index) {
+    return led_colors[index];
+}
+
+void test_rgb_matrix_clear_colors(void) {
+    memset(led_colors, 0, sizeof(led_colors));
+}
+
+static void init(void) {
+    test_rgb_matrix_reset_layout();
+    test_rgb_matrix_clear_colors();
+}
+
+static void set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    led_colors[index] = (rgb_t){r, g, b};
+}
+
+static void set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        set_color(i, r, g, b);
+    }
+}
+
+static void flush(void) {}
+
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = init,
+    .set_color     = set_color,
+    .set_color_all = set_color_all,
+    .flush         = flush,
+};
+
+#endif // RGB_MATRIX_ENABLE
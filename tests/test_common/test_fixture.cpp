@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <string>
 #include "gmock/gmock-cardinalities.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -23,6 +24,9 @@ extern "C" {
 #include "debug.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
 
 void set_time(uint32_t t);
 void advance_time(uint32_t ms);
@@ -59,6 +63,9 @@ void TestFixture::TearDownTestCase() {}
 TestFixture::TestFixture() {
     m_this = this;
     timer_clear();
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_clear();
+#endif
     keyrecord_t empty_keyrecord = {0};
     test_logger.info() << "tapping term is " << +GET_TAPPING_TERM(KC_TRANSPARENT, &empty_keyrecord) << "ms" << std::endl;
 }
@@ -179,12 +186,33 @@ void TestFixture::run_one_scan_loop() {
 void TestFixture::idle_for(unsigned time) {
     test_logger.trace() << +time << " keyboard task " << (time > 1 ? "loops" : "loop") << std::endl;
     for (unsigned i = 0; i < time; i++) {
-        keyboard_task();
-        housekeeping_task();
+        run_keyboard_task();
         advance_time(1);
     }
 }
 
+void TestFixture::run_keyboard_task() {
+    keyboard_task();
+    housekeeping_task();
+}
+
+#ifdef LATENCY_TRACE_ENABLE
+void TestFixture::expect_latency(const KeymapKey& key, bool pressed, uint32_t max_ms) const {
+    const latency_trace_t* trace = latency_trace_find(key.position, pressed);
+    if (trace == nullptr) {
+        ADD_FAILURE() << "no latency trace for " << key.name << (pressed ? " press" : " release");
+        return;
+    }
+
+    auto stage = [trace](latency_stage_t stage) {
+        uint32_t latency = latency_trace_latency(trace, stage);
+        return latency == UINT32_MAX ? std::string("never") : "after " + std::to_string(latency) + "ms";
+    };
+
+    EXPECT_LE(latency_trace_latency(trace, LATENCY_STAGE_REPORT), max_ms) << key.name << (pressed ? " press" : " release") << " reached action " << stage(LATENCY_STAGE_ACTION) << ", process " << stage(LATENCY_STAGE_PROCESS) << " and the host " << stage(LATENCY_STAGE_REPORT);
+}
+#endif
+
 void TestFixture::print_test_log() const {
     const ::testing::TestInfo* const test_info = ::testing::UnitTest::GetInstance()->current_test_info();
     if (HasFailure()) {
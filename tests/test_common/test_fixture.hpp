@@ -65,7 +65,20 @@ class TestFixture : public testing::Test {
 
     void expect_layer_state(layer_t layer) const;
 
+#ifdef LATENCY_TRACE_ENABLE
+    /**
+     * @brief Expects the last press (or release) of `key` to have been sent to
+     * the host at most `max_ms` after the matrix change, see latency_trace.h.
+     */
+    void expect_latency(const KeymapKey& key, bool pressed, uint32_t max_ms) const;
+#endif
+
    protected:
+    /**
+     * @brief Runs `keyboard_task()` and `housekeeping_task()` once, for every loop of `idle_for()`.
+     */
+    virtual void run_keyboard_task();
+
     void                   print_test_log() const;
     std::vector<KeymapKey> keymap;
 };
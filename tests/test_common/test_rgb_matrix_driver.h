@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "color.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// LEDs up to MATRIX_ROWS * MATRIX_COLS sit under the keys of the test matrix,
+// any further LEDs are spread along the edges of the board as underglow.
+void test_rgb_matrix_reset_layout(void);
+
+rgb_t test_rgb_matrix_get_color(uint8_t index);
+void  test_rgb_matrix_clear_colors(void);
+
+#ifdef __cplusplus
+}
+#endif
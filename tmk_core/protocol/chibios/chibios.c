@@ -205,6 +205,9 @@ void protocol_pre_task(void) {
 void protocol_post_task(void) {
 #ifdef VIRTSER_ENABLE
     virtser_task();
+#endif
+#ifdef USB_REPORT_COALESCING
+    usb_coalesced_report_task();
 #endif
     usb_idle_task();
 }
@@ -320,6 +320,63 @@ bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
     return inactive;
 }
 
+/**
+ * @brief Sends a report without waiting for the endpoint, merging it into the
+ * last one if that is still held back.
+ *
+ * Only a report that can't be merged, e.g. because a button changed, makes the
+ * held back report be queued as is, which may wait up to `timeout` for a free
+ * buffer.
+ */
+bool usb_endpoint_in_send_coalesced(usb_endpoint_in_t *endpoint, usb_coalesced_report_t *report, const uint8_t *data, sysinterval_t timeout) {
+    osalDbgCheck((endpoint != NULL) && (report != NULL) && (data != NULL));
+
+    if (report->pending && !report->merge(report->data, data)) {
+        report->pending = false;
+        if (!usb_endpoint_in_send(endpoint, report->data, report->size, timeout, false)) {
+            return false;
+        }
+    }
+
+    if (!report->pending) {
+        memcpy(report->data, data, report->size);
+        report->pending = true;
+    }
+
+    return usb_endpoint_in_flush_coalesced(endpoint, report);
+}
+
+/**
+ * @brief Queues the held back report once everything before it has been sent.
+ *
+ * Waiting for the endpoint to go idle means the report always has a free
+ * buffer, and carries the latest state by the time the host polls for it.
+ * Needs to be called regularly from the main loop.
+ */
+bool usb_endpoint_in_flush_coalesced(usb_endpoint_in_t *endpoint, usb_coalesced_report_t *report) {
+    osalDbgCheck((endpoint != NULL) && (report != NULL));
+
+    if (!report->pending) {
+        return true;
+    }
+
+    osalSysLock();
+    bool active = usbGetDriverStateI(endpoint->config.usbp) == USB_ACTIVE;
+    osalSysUnlock();
+
+    if (!active) {
+        report->pending = false;
+        return false;
+    }
+
+    if (!usb_endpoint_in_is_inactive(endpoint)) {
+        return true;
+    }
+
+    report->pending = false;
+    return usb_endpoint_in_send(endpoint, report->data, report->size, TIME_IMMEDIATE, false);
+}
+
 bool usb_endpoint_out_receive(usb_endpoint_out_t *endpoint, uint8_t *data, size_t size, sysinterval_t timeout) {
     osalDbgCheck((endpoint != NULL) && (data != NULL) && (size > 0U));
 
@@ -168,6 +168,31 @@ typedef struct {
     usb_report_storage_t *report_storage;
 } usb_endpoint_in_t;
 
+/**
+ * @brief A report held back while its endpoint is busy, which later reports are merged into
+ */
+typedef struct {
+    /**
+     * @brief Storage for the held back report
+     */
+    uint8_t *data;
+
+    /**
+     * @brief Size of the report
+     */
+    size_t size;
+
+    /**
+     * @brief Merges a new report into the held back one, returning false if they can't be combined, e.g. a button changed
+     */
+    bool (*merge)(uint8_t *pending, const uint8_t *report);
+
+    /**
+     * @brief Whether a report is being held back
+     */
+    bool pending;
+} usb_coalesced_report_t;
+
 typedef struct {
     input_buffers_queue_t ibqueue;
     USBEndpointConfig     ep_config;
@@ -188,6 +213,9 @@ bool usb_endpoint_in_send(usb_endpoint_in_t *endpoint, const uint8_t *data, size
 void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded);
 bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint);
 
+bool usb_endpoint_in_send_coalesced(usb_endpoint_in_t *endpoint, usb_coalesced_report_t *report, const uint8_t *data, sysinterval_t timeout);
+bool usb_endpoint_in_flush_coalesced(usb_endpoint_in_t *endpoint, usb_coalesced_report_t *report);
+
 void usb_endpoint_in_suspend_cb(usb_endpoint_in_t *endpoint);
 void usb_endpoint_in_wakeup_cb(usb_endpoint_in_t *endpoint);
 void usb_endpoint_in_configure_cb(usb_endpoint_in_t *endpoint);
@@ -27,6 +27,7 @@
 #include "usb_descriptor.h"
 #include "usb_driver.h"
 #include "usb_types.h"
+#include "util.h"
 
 #ifdef RAW_ENABLE
 #    include "raw_hid.h"
@@ -454,9 +455,46 @@ void send_nkro(report_nkro_t *report) {
  * ---------------------------------------------------------
  */
 
+#if defined(MOUSE_ENABLE) && defined(USB_REPORT_COALESCING)
+/* Motion is summed, as long as the buttons are unchanged and the total still fits in a report. */
+static bool merge_mouse_report(uint8_t *pending, const uint8_t *report) {
+    report_mouse_t       *old_report = (report_mouse_t *)pending;
+    const report_mouse_t *new_report = (const report_mouse_t *)report;
+
+    int32_t x = old_report->x + new_report->x;
+    int32_t y = old_report->y + new_report->y;
+    int32_t h = old_report->h + new_report->h;
+    int32_t v = old_report->v + new_report->v;
+
+    if (old_report->buttons != new_report->buttons) {
+        return false;
+    }
+    if (x < MOUSE_REPORT_XY_MIN || x > MOUSE_REPORT_XY_MAX || y < MOUSE_REPORT_XY_MIN || y > MOUSE_REPORT_XY_MAX || h < MOUSE_REPORT_HV_MIN || h > MOUSE_REPORT_HV_MAX || v < MOUSE_REPORT_HV_MIN || v > MOUSE_REPORT_HV_MAX) {
+        return false;
+    }
+
+    old_report->x = x;
+    old_report->y = y;
+    old_report->h = h;
+    old_report->v = v;
+#    ifdef MOUSE_EXTENDED_REPORT
+    old_report->boot_x = MIN(MAX(x, -127), 127);
+    old_report->boot_y = MIN(MAX(y, -127), 127);
+#    endif
+    return true;
+}
+
+static report_mouse_t         mouse_report_pending;
+static usb_coalesced_report_t mouse_report_coalesced = {.data = (uint8_t *)&mouse_report_pending, .size = sizeof(report_mouse_t), .merge = merge_mouse_report};
+#endif
+
 void send_mouse(report_mouse_t *report) {
 #ifdef MOUSE_ENABLE
+#    ifdef USB_REPORT_COALESCING
+    usb_endpoint_in_send_coalesced(&usb_endpoints_in[USB_ENDPOINT_IN_MOUSE], &mouse_report_coalesced, (uint8_t *)report, TIME_MS2I(100));
+#    else
     send_report(USB_ENDPOINT_IN_MOUSE, report, sizeof(report_mouse_t));
+#    endif
 #endif
 }
 
@@ -477,18 +515,83 @@ void send_programmable_button(report_programmable_button_t *report) {
 #endif
 }
 
+#if defined(JOYSTICK_ENABLE) && defined(USB_REPORT_COALESCING)
+/* Axes are replaced with the latest position, as long as the buttons and hat are unchanged. */
+static bool merge_joystick_report(uint8_t *pending, const uint8_t *report) {
+    report_joystick_t       *old_report = (report_joystick_t *)pending;
+    const report_joystick_t *new_report = (const report_joystick_t *)report;
+
+#    ifdef JOYSTICK_HAS_HAT
+    if (old_report->hat != new_report->hat) {
+        return false;
+    }
+#    endif
+#    if JOYSTICK_BUTTON_COUNT > 0
+    if (memcmp(old_report->buttons, new_report->buttons, sizeof(old_report->buttons)) != 0) {
+        return false;
+    }
+#    endif
+
+    memcpy(old_report, new_report, sizeof(report_joystick_t));
+    return true;
+}
+
+static report_joystick_t      joystick_report_pending;
+static usb_coalesced_report_t joystick_report_coalesced = {.data = (uint8_t *)&joystick_report_pending, .size = sizeof(report_joystick_t), .merge = merge_joystick_report};
+#endif
+
 void send_joystick(report_joystick_t *report) {
 #ifdef JOYSTICK_ENABLE
+#    ifdef USB_REPORT_COALESCING
+    usb_endpoint_in_send_coalesced(&usb_endpoints_in[USB_ENDPOINT_IN_JOYSTICK], &joystick_report_coalesced, (uint8_t *)report, TIME_MS2I(100));
+#    else
     send_report(USB_ENDPOINT_IN_JOYSTICK, report, sizeof(report_joystick_t));
+#    endif
 #endif
 }
 
+#if defined(DIGITIZER_ENABLE) && defined(USB_REPORT_COALESCING)
+/* The position is replaced with the latest one, as long as the tip, barrel and range states are unchanged. */
+static bool merge_digitizer_report(uint8_t *pending, const uint8_t *report) {
+    report_digitizer_t       *old_report = (report_digitizer_t *)pending;
+    const report_digitizer_t *new_report = (const report_digitizer_t *)report;
+
+    if (old_report->in_range != new_report->in_range || old_report->tip != new_report->tip || old_report->barrel != new_report->barrel) {
+        return false;
+    }
+
+    memcpy(old_report, new_report, sizeof(report_digitizer_t));
+    return true;
+}
+
+static report_digitizer_t     digitizer_report_pending;
+static usb_coalesced_report_t digitizer_report_coalesced = {.data = (uint8_t *)&digitizer_report_pending, .size = sizeof(report_digitizer_t), .merge = merge_digitizer_report};
+#endif
+
 void send_digitizer(report_digitizer_t *report) {
 #ifdef DIGITIZER_ENABLE
+#    ifdef USB_REPORT_COALESCING
+    usb_endpoint_in_send_coalesced(&usb_endpoints_in[USB_ENDPOINT_IN_DIGITIZER], &digitizer_report_coalesced, (uint8_t *)report, TIME_MS2I(100));
+#    else
     send_report(USB_ENDPOINT_IN_DIGITIZER, report, sizeof(report_digitizer_t));
+#    endif
 #endif
 }
 
+#ifdef USB_REPORT_COALESCING
+void usb_coalesced_report_task(void) {
+#    ifdef MOUSE_ENABLE
+    usb_endpoint_in_flush_coalesced(&usb_endpoints_in[USB_ENDPOINT_IN_MOUSE], &mouse_report_coalesced);
+#    endif
+#    ifdef JOYSTICK_ENABLE
+    usb_endpoint_in_flush_coalesced(&usb_endpoints_in[USB_ENDPOINT_IN_JOYSTICK], &joystick_report_coalesced);
+#    endif
+#    ifdef DIGITIZER_ENABLE
+    usb_endpoint_in_flush_coalesced(&usb_endpoints_in[USB_ENDPOINT_IN_DIGITIZER], &digitizer_report_coalesced);
+#    endif
+}
+#endif
+
 /* ---------------------------------------------------------
  *                   Console functions
  * ---------------------------------------------------------
@@ -45,6 +45,18 @@ void usb_event_queue_init(void);
 /* Task to dequeue and execute any handlers for the USB events on the main thread */
 void usb_event_queue_task(void);
 
+/* ------------------------
+ * Report coalescing header
+ * ------------------------
+ */
+
+#ifdef USB_REPORT_COALESCING
+
+/* Queues any mouse, joystick or digitizer report held back while its endpoint was busy */
+void usb_coalesced_report_task(void);
+
+#endif
+
 /* --------------
  * Console header
  * --------------
@@ -36,6 +36,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "connection.h"
 #endif
 
+#ifdef LATENCY_TRACE_ENABLE
+#    include "latency_trace.h"
+#endif
+
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 
@@ -182,6 +186,9 @@ void host_keyboard_send(report_keyboard_t *report) {
     report->report_id = REPORT_ID_KEYBOARD;
 #endif
     (*driver->send_keyboard)(report);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report();
+#endif
 
     if (debug_keyboard) {
         dprintf("keyboard_report: %02X | ", report->mods);
@@ -198,6 +205,9 @@ void host_nkro_send(report_nkro_t *report) {
 
     report->report_id = REPORT_ID_NKRO;
     (*driver->send_nkro)(report);
+#ifdef LATENCY_TRACE_ENABLE
+    latency_trace_report();
+#endif
 
     if (debug_keyboard) {
         dprintf("nkro_report: %02X | ", report->mods);